@@ -5,15 +5,24 @@
 #ifndef INCLUDE_V8_JSON_H_
 #define INCLUDE_V8_JSON_H_
 
+#include <memory>
+
 #include "v8-local-handle.h"  // NOLINT(build/include_directory)
+#include "v8-maybe.h"         // NOLINT(build/include_directory)
 #include "v8config.h"         // NOLINT(build/include_directory)
 
 namespace v8 {
 
 class Context;
+class Isolate;
+class OutputStream;
 class Value;
 class String;
 
+namespace internal {
+class JsonStreamingParser;
+}  // namespace internal
+
 /**
  * A JSON Parser and Stringifier.
  */
@@ -40,6 +49,71 @@ class V8_EXPORT JSON {
   static V8_WARN_UNUSED_RESULT MaybeLocal<String> Stringify(
       Local<Context> context, Local<Value> json_object,
       Local<String> gap = Local<String>());
+
+  /**
+   * Like Stringify, but writes the result to |stream| as UTF-8 instead of
+   * returning it as a string, so that the result is never materialized as a
+   * whole. The output is passed to OutputStream::WriteAsciiChunk in chunks of
+   * at most OutputStream::GetChunkSize() bytes, and EndOfStream is called
+   * once the whole result was written. Returning kAbort from WriteAsciiChunk
+   * stops the serialization.
+   *
+   * The stream is called while the serialization is in progress, so it must
+   * not call back into V8. In particular, it must not run JavaScript, which
+   * is checked.
+   *
+   * \param json_object The JSON-serializable object to stringify.
+   * \param stream The stream to write the UTF-8 encoded result to.
+   * \return True if the whole result was written, false if the stream
+   *   aborted, or nothing if an exception was thrown.
+   */
+  static V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToStream(
+      Local<Context> context, Local<Value> json_object, OutputStream* stream,
+      Local<String> gap = Local<String>());
+
+  /**
+   * Parses JSON text that arrives in chunks, see ParseStreaming.
+   */
+  class V8_EXPORT StreamingParser {
+   public:
+    enum class Encoding {
+      // Each byte is a Latin-1 character.
+      kOneByte,
+      // The text is UTF-8 encoded. Characters may be split across chunks, and
+      // invalid byte sequences are replaced with U+FFFD.
+      kUtf8
+    };
+
+    StreamingParser(Isolate* isolate, Encoding encoding);
+    ~StreamingParser();
+    StreamingParser(const StreamingParser&) = delete;
+    StreamingParser& operator=(const StreamingParser&) = delete;
+
+    /**
+     * Appends the next chunk of the JSON text. This doesn't access the V8
+     * heap and may be called on any thread, but not concurrently with other
+     * calls on the same parser.
+     */
+    void Append(const char* data, size_t length);
+
+    /**
+     * Parses the text appended so far and returns the value like Parse. Must
+     * be called exactly once, after the last chunk was appended.
+     */
+    V8_WARN_UNUSED_RESULT MaybeLocal<Value> Finish(Local<Context> context);
+
+   private:
+    std::unique_ptr<internal::JsonStreamingParser> impl_;
+  };
+
+  /**
+   * Returns a parser for JSON text that arrives in chunks, for example from
+   * the network. The chunks are decoded as they arrive and don't need to be
+   * concatenated into a string by the embedder.
+   */
+  static std::unique_ptr<StreamingParser> ParseStreaming(
+      Isolate* isolate,
+      StreamingParser::Encoding encoding = StreamingParser::Encoding::kUtf8);
 };
 
 }  // namespace v8
@@ -22,6 +22,34 @@ class Isolate;
 class MicrotaskQueue;
 }  // namespace internal
 
+/**
+ * Statistics about the microtasks run on a MicrotaskQueue, see
+ * MicrotaskQueue::GetStatistics.
+ */
+struct MicrotaskQueueStatistics {
+  /**
+   * The number of microtasks that ran on the queue.
+   */
+  size_t microtask_count = 0;
+
+  /**
+   * The number of checkpoints that ran at least one microtask.
+   */
+  size_t checkpoint_count = 0;
+
+  /**
+   * The largest number of microtasks that were pending at the start of a
+   * checkpoint.
+   */
+  size_t max_queue_depth = 0;
+
+  /**
+   * The total wall-clock time spent running microtasks, in milliseconds.
+   * Together with microtask_count, this gives the microtask throughput.
+   */
+  double run_time_ms = 0;
+};
+
 /**
  * Represents the microtask queue, where microtasks are stored and processed.
  * https://html.spec.whatwg.org/multipage/webappapis.html#microtask-queue
@@ -97,6 +125,12 @@ class V8_EXPORT MicrotaskQueue {
    */
   virtual int GetMicrotasksScopeDepth() const = 0;
 
+  /**
+   * Returns statistics about the microtasks that ran on this MicrotaskQueue
+   * instance so far.
+   */
+  virtual MicrotaskQueueStatistics GetStatistics() const = 0;
+
   MicrotaskQueue(const MicrotaskQueue&) = delete;
   MicrotaskQueue& operator=(const MicrotaskQueue&) = delete;
 
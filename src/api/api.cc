@@ -70,6 +70,7 @@
 #include "src/init/startup-data-util.h"
 #include "src/init/v8.h"
 #include "src/json/json-parser.h"
+#include "src/json/json-streaming-parser.h"
 #include "src/json/json-stringifier.h"
 #include "src/logging/counters-scopes.h"
 #include "src/logging/metrics.h"
@@ -3403,6 +3404,32 @@ MaybeLocal<Value> JSON::Parse(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+JSON::StreamingParser::StreamingParser(Isolate* isolate, Encoding encoding)
+    : impl_(std::make_unique<i::JsonStreamingParser>(
+          reinterpret_cast<i::Isolate*>(isolate),
+          encoding == Encoding::kUtf8
+              ? i::JsonStreamingParser::Encoding::kUtf8
+              : i::JsonStreamingParser::Encoding::kOneByte)) {}
+
+JSON::StreamingParser::~StreamingParser() = default;
+
+void JSON::StreamingParser::Append(const char* data, size_t length) {
+  impl_->Append(reinterpret_cast<const uint8_t*>(data), length);
+}
+
+MaybeLocal<Value> JSON::StreamingParser::Finish(Local<Context> context) {
+  PREPARE_FOR_EXECUTION(context, JSON, ParseStreaming);
+  Local<Value> result;
+  has_exception = !ToLocal<Value>(impl_->Finish(), &result);
+  RETURN_ON_FAILED_EXECUTION(Value);
+  RETURN_ESCAPED(result);
+}
+
+std::unique_ptr<JSON::StreamingParser> JSON::ParseStreaming(
+    Isolate* isolate, StreamingParser::Encoding encoding) {
+  return std::make_unique<StreamingParser>(isolate, encoding);
+}
+
 MaybeLocal<String> JSON::Stringify(Local<Context> context,
                                    Local<Value> json_object,
                                    Local<String> gap) {
@@ -3423,6 +3450,24 @@ MaybeLocal<String> JSON::Stringify(Local<Context> context,
   RETURN_ESCAPED(result);
 }
 
+Maybe<bool> JSON::StringifyToStream(Local<Context> context,
+                                    Local<Value> json_object,
+                                    OutputStream* stream, Local<String> gap) {
+  Utils::ApiCheck(stream != nullptr, "v8::JSON::StringifyToStream",
+                  "stream must not be null");
+  auto i_isolate = reinterpret_cast<i::Isolate*>(context->GetIsolate());
+  ENTER_V8(i_isolate, context, JSON, StringifyToStream, i::HandleScope);
+  auto object = Utils::OpenHandle(*json_object);
+  i::Handle<i::String> gap_string = gap.IsEmpty()
+                                        ? i_isolate->factory()->empty_string()
+                                        : Utils::OpenHandle(*gap);
+  Maybe<bool> result =
+      i::JsonStringifyToStream(i_isolate, object, gap_string, stream);
+  has_exception = result.IsNothing();
+  RETURN_ON_FAILED_EXECUTION_PRIMITIVE(bool);
+  return result;
+}
+
 // --- V a l u e   S e r i a l i z a t i o n ---
 
 SharedValueConveyor::SharedValueConveyor(SharedValueConveyor&& other) noexcept
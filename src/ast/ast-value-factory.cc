@@ -32,6 +32,7 @@
 #include "src/common/globals.h"
 #include "src/heap/factory-inl.h"
 #include "src/heap/local-factory-inl.h"
+#include "src/objects/string-table.h"
 #include "src/objects/string.h"
 #include "src/strings/string-hasher.h"
 #include "src/utils/utils-inl.h"
@@ -57,26 +58,13 @@ class OneByteStringStream {
 
 }  // namespace
 
-template <typename IsolateT>
-void AstRawString::Internalize(IsolateT* isolate) {
-  DCHECK(!has_string_);
-  if (literal_bytes_.empty()) {
-    set_string(isolate->factory()->empty_string());
-  } else if (is_one_byte()) {
-    OneByteStringKey key(raw_hash_field_, literal_bytes_);
-    set_string(isolate->factory()->InternalizeStringWithKey(&key));
-  } else {
-    TwoByteStringKey key(raw_hash_field_,
-                         base::Vector<const uint16_t>::cast(literal_bytes_));
-    set_string(isolate->factory()->InternalizeStringWithKey(&key));
-  }
+template <typename Char>
+SequentialStringKey<Char> AstRawString::GetStringTableKey() const {
+  DCHECK_EQ(is_one_byte(), sizeof(Char) == 1);
+  return SequentialStringKey<Char>(
+      raw_hash_field_, base::Vector<const Char>::cast(literal_bytes_));
 }
 
-template EXPORT_TEMPLATE_DEFINE(
-    V8_EXPORT_PRIVATE) void AstRawString::Internalize(Isolate* isolate);
-template EXPORT_TEMPLATE_DEFINE(
-    V8_EXPORT_PRIVATE) void AstRawString::Internalize(LocalIsolate* isolate);
-
 bool AstRawString::AsArrayIndex(uint32_t* index) const {
   // The StringHasher will set up the hash. Bail out early if we know it
   // can't be convertible to an array index.
@@ -371,12 +359,37 @@ AstConsString* AstValueFactory::NewConsString(const AstRawString* str1,
 template <typename IsolateT>
 void AstValueFactory::Internalize(IsolateT* isolate) {
   // Strings need to be internalized before values, because values refer to
-  // strings.
+  // strings. They are looked up in the string table in two batches, one for
+  // one-byte and one for two-byte strings.
+  std::vector<AstRawString*> one_byte_strings;
+  std::vector<OneByteStringKey> one_byte_keys;
+  std::vector<AstRawString*> two_byte_strings;
+  std::vector<TwoByteStringKey> two_byte_keys;
   for (AstRawString* current = strings_; current != nullptr;) {
     AstRawString* next = current->next();
-    current->Internalize(isolate);
+    if (current->IsEmpty()) {
+      current->set_string(isolate->factory()->empty_string());
+    } else if (current->is_one_byte()) {
+      one_byte_strings.push_back(current);
+      one_byte_keys.push_back(current->GetStringTableKey<uint8_t>());
+    } else {
+      two_byte_strings.push_back(current);
+      two_byte_keys.push_back(current->GetStringTableKey<uint16_t>());
+    }
     current = next;
   }
+  auto internalize_batch = [isolate](
+                               auto keys,
+                               const std::vector<AstRawString*>& strings) {
+    if (keys.empty()) return;
+    std::vector<Handle<String>> results(keys.size());
+    isolate->string_table()->LookupKeys(isolate, keys, base::VectorOf(results));
+    for (size_t i = 0; i < strings.size(); i++) {
+      strings[i]->set_string(results[i]);
+    }
+  };
+  internalize_batch(base::VectorOf(one_byte_keys), one_byte_strings);
+  internalize_batch(base::VectorOf(two_byte_keys), two_byte_strings);
 
   ResetStrings();
 }
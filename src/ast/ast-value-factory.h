@@ -46,6 +46,8 @@ namespace v8 {
 namespace internal {
 
 class Isolate;
+template <typename Char>
+class SequentialStringKey;
 
 class AstRawString final : public ZoneObject {
  public:
@@ -66,9 +68,6 @@ class AstRawString final : public ZoneObject {
   V8_EXPORT_PRIVATE bool IsOneByteEqualTo(const char* data) const;
   uint16_t FirstCharacter() const;
 
-  template <typename IsolateT>
-  void Internalize(IsolateT* isolate);
-
   // Access the physical representation:
   bool is_one_byte() const { return is_one_byte_; }
   int byte_length() const { return literal_bytes_.length(); }
@@ -116,6 +115,11 @@ class AstRawString final : public ZoneObject {
     return &next_;
   }
 
+  // Returns the key to look the literal up in the string table with. {Char}
+  // has to match the width of the literal.
+  template <typename Char>
+  SequentialStringKey<Char> GetStringTableKey() const;
+
   void set_string(Handle<String> string) {
     DCHECK(!string.is_null());
     DCHECK(!has_string_);
@@ -141,11 +145,6 @@ class AstRawString final : public ZoneObject {
 #endif
 };
 
-extern template EXPORT_TEMPLATE_DECLARE(
-    V8_EXPORT_PRIVATE) void AstRawString::Internalize(Isolate* isolate);
-extern template EXPORT_TEMPLATE_DECLARE(
-    V8_EXPORT_PRIVATE) void AstRawString::Internalize(LocalIsolate* isolate);
-
 class AstConsString final : public ZoneObject {
  public:
   AstConsString* AddString(Zone* zone, const AstRawString* s) {
@@ -164,6 +164,10 @@ void BaselineAssembler::JumpIfSmi(Condition cc, Register lhs, Register rhs,
   __ AssertSmi(rhs);
   JumpIf(cc, lhs, Operand(rhs), target);
 }
+void BaselineAssembler::JumpIfTagged(Condition cc, Register lhs, Register rhs,
+                                     Label* target, Label::Distance) {
+  JumpIf(cc, lhs, Operand(rhs), target);
+}
 void BaselineAssembler::JumpIfTagged(Condition cc, Register value,
                                      MemOperand operand, Label* target,
                                      Label::Distance) {
@@ -342,6 +346,11 @@ void BaselineAssembler::LoadWord16FieldZeroExtend(Register output,
   __ ldrh(output, FieldMemOperand(source, offset));
 }
 
+void BaselineAssembler::LoadWeakValue(Register in_out,
+                                      Label* target_if_cleared) {
+  __ LoadWeakValue(in_out, in_out, target_if_cleared);
+}
+
 void BaselineAssembler::LoadWord8Field(Register output, Register source,
                                        int offset) {
   __ ldrb(output, FieldMemOperand(source, offset));
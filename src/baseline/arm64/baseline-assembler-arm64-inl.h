@@ -182,6 +182,10 @@ void BaselineAssembler::JumpIfSmi(Condition cc, Register lhs, Register rhs,
   __ AssertSmi(rhs);
   __ CompareTaggedAndBranch(lhs, rhs, cc, target);
 }
+void BaselineAssembler::JumpIfTagged(Condition cc, Register lhs, Register rhs,
+                                     Label* target, Label::Distance) {
+  __ CompareTaggedAndBranch(lhs, rhs, cc, target);
+}
 void BaselineAssembler::JumpIfTagged(Condition cc, Register value,
                                      MemOperand operand, Label* target,
                                      Label::Distance) {
@@ -417,6 +421,11 @@ void BaselineAssembler::LoadWord16FieldZeroExtend(Register output,
   __ Ldrh(output, FieldMemOperand(source, offset));
 }
 
+void BaselineAssembler::LoadWeakValue(Register in_out,
+                                      Label* target_if_cleared) {
+  __ LoadWeakValue(in_out, in_out, target_if_cleared);
+}
+
 void BaselineAssembler::LoadWord8Field(Register output, Register source,
                                        int offset) {
   __ Ldrb(output, FieldMemOperand(source, offset));
@@ -86,6 +86,9 @@ class BaselineAssembler {
   inline void JumpIfImmediate(Condition cc, Register left, int right,
                               Label* target,
                               Label::Distance distance = Label::kFar);
+  inline void JumpIfTagged(Condition cc, Register lhs, Register rhs,
+                           Label* target,
+                           Label::Distance distance = Label::kFar);
   inline void JumpIfTagged(Condition cc, Register value, MemOperand operand,
                            Label* target,
                            Label::Distance distance = Label::kFar);
@@ -161,6 +164,9 @@ class BaselineAssembler {
                                             int offset);
   inline void LoadWord16FieldZeroExtend(Register output, Register source,
                                         int offset);
+  // Strips the weak tag off {in_out}, or jumps to {target_if_cleared} if it is
+  // a cleared weak reference.
+  inline void LoadWeakValue(Register in_out, Label* target_if_cleared);
   inline void LoadWord8Field(Register output, Register source, int offset);
   inline void StoreTaggedSignedField(Register target, int offset,
                                      Tagged<Smi> value);
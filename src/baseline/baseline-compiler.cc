@@ -20,10 +20,12 @@
 #include "src/common/globals.h"
 #include "src/execution/frame-constants.h"
 #include "src/heap/local-factory-inl.h"
+#include "src/ic/handler-configuration-inl.h"
 #include "src/interpreter/bytecode-array-iterator.h"
 #include "src/interpreter/bytecode-flags.h"
 #include "src/logging/runtime-call-stats-scope.h"
 #include "src/objects/code.h"
+#include "src/objects/feedback-vector-inl.h"
 #include "src/objects/heap-object.h"
 #include "src/objects/instance-type.h"
 #include "src/objects/literal-objects-inl.h"
@@ -270,11 +272,13 @@ std::unique_ptr<AssemblerBuffer> AllocateBuffer(
 BaselineCompiler::BaselineCompiler(
     LocalIsolate* local_isolate,
     Handle<SharedFunctionInfo> shared_function_info,
-    Handle<BytecodeArray> bytecode)
+    Handle<BytecodeArray> bytecode,
+    Handle<internal::FeedbackVector> feedback_vector)
     : local_isolate_(local_isolate),
       stats_(local_isolate->runtime_call_stats()),
       shared_function_info_(shared_function_info),
       bytecode_(bytecode),
+      feedback_vector_(feedback_vector),
       masm_(
           local_isolate->GetMainThreadIsolateUnsafe(),
           BaselineAssemblerOptions(local_isolate->GetMainThreadIsolateUnsafe()),
@@ -436,6 +440,38 @@ MemOperand BaselineCompiler::FeedbackVector() {
   return __ FeedbackVectorOperand();
 }
 
+bool BaselineCompiler::TryGetMonomorphicFieldLoad(FeedbackSlot slot,
+                                                  Tagged<Smi>* handler) {
+  if (!v8_flags.sparkplug_inline_monomorphic_loads) return false;
+  if (feedback_vector_.is_null()) return false;
+  FeedbackNexus nexus(feedback_vector_, slot);
+  if (nexus.kind() != FeedbackSlotKind::kLoadProperty) return false;
+  if (nexus.ic_state() != InlineCacheState::MONOMORPHIC) return false;
+  std::vector<MapAndHandler> maps_and_handlers;
+  if (nexus.ExtractMapsAndHandlers(&maps_and_handlers) != 1) return false;
+
+  Handle<Map> receiver_map = maps_and_handlers[0].first;
+  Tagged<MaybeObject> maybe_handler = *maps_and_handlers[0].second;
+  if (!IsJSObjectMap(*receiver_map) || receiver_map->is_dictionary_map() ||
+      receiver_map->is_deprecated()) {
+    return false;
+  }
+  if (!IsSmi(maybe_handler)) return false;
+  // Only plain tagged own fields of the receiver; everything else (doubles,
+  // access checks, prototype chain lookups) is left to the IC.
+  int raw_handler = maybe_handler.ToSmi().value();
+  if (LoadHandler::KindBits::decode(raw_handler) !=
+          LoadHandler::Kind::kField ||
+      LoadHandler::DoAccessCheckOnLookupStartObjectBits::decode(raw_handler) ||
+      LoadHandler::LookupOnLookupStartObjectBits::decode(raw_handler) ||
+      LoadHandler::IsWasmStructBits::decode(raw_handler) ||
+      LoadHandler::IsDoubleBits::decode(raw_handler)) {
+    return false;
+  }
+  *handler = maybe_handler.ToSmi();
+  return true;
+}
+
 void BaselineCompiler::LoadFeedbackVector(Register output) {
   ASM_CODE_COMMENT(&masm_);
   __ Move(output, __ FeedbackVectorOperand());
@@ -909,6 +945,53 @@ void BaselineCompiler::VisitMov() {
 }
 
 void BaselineCompiler::VisitGetNamedProperty() {
+  FeedbackSlot slot = iterator().GetSlotOperand(2);
+  Tagged<Smi> handler;
+  if (TryGetMonomorphicFieldLoad(slot, &handler)) {
+    // Only the field is fixed at compile time. The map is checked against the
+    // weak map in the feedback of the running closure, so that the code
+    // doesn't keep the map alive, and the handler is checked as well, since
+    // the code is shared between closures. Any mismatch, including the IC
+    // having left the monomorphic state, takes the IC.
+    ASM_CODE_COMMENT_STRING(&masm_, "Inline monomorphic field load");
+    int raw_handler = handler.value();
+    int offset =
+        LoadHandler::FieldIndexBits::decode(raw_handler) * kTaggedSize;
+    bool is_inobject = LoadHandler::IsInobjectBits::decode(raw_handler);
+    Label slow, done;
+    {
+      // The accumulator is overwritten by the load either way, so it can hold
+      // the feedback entries until then.
+      Register feedback_entry = kInterpreterAccumulatorRegister;
+      BaselineAssembler::ScratchRegisterScope scratch_scope(&basm_);
+      Register object = scratch_scope.AcquireScratch();
+      Register scratch = scratch_scope.AcquireScratch();
+      LoadRegister(object, 0);
+      __ JumpIfSmi(object, &slow, Label::kNear);
+      LoadFeedbackVector(scratch);
+      __ LoadTaggedField(feedback_entry, scratch,
+                         FeedbackVector::OffsetOfElementAt(slot.ToInt()));
+      __ LoadWeakValue(feedback_entry, &slow);
+      __ LoadTaggedField(
+          scratch, scratch,
+          FeedbackVector::OffsetOfElementAt(slot.WithOffset(1).ToInt()));
+      __ JumpIfNotSmi(scratch, &slow, Label::kNear);
+      __ JumpIfSmi(kNotEqual, scratch, handler, &slow, Label::kNear);
+      __ LoadMap(scratch, object);
+      __ JumpIfTagged(kNotEqual, scratch, feedback_entry, &slow, Label::kNear);
+      if (!is_inobject) {
+        __ LoadTaggedField(object, object, JSObject::kPropertiesOrHashOffset);
+      }
+      __ LoadTaggedField(kInterpreterAccumulatorRegister, object, offset);
+      __ Jump(&done);
+    }
+    __ Bind(&slow);
+    CallBuiltin<Builtin::kLoadICBaseline>(RegisterOperand(0),  // object
+                                          Constant<Name>(1),   // name
+                                          IndexAsTagged(2));   // slot
+    __ Bind(&done);
+    return;
+  }
   CallBuiltin<Builtin::kLoadICBaseline>(RegisterOperand(0),  // object
                                         Constant<Name>(1),   // name
                                         IndexAsTagged(2));   // slot
@@ -23,6 +23,7 @@ namespace v8 {
 namespace internal {
 
 class BytecodeArray;
+class FeedbackVector;
 
 namespace baseline {
 
@@ -50,7 +51,9 @@ class BaselineCompiler {
  public:
   explicit BaselineCompiler(LocalIsolate* local_isolate,
                             Handle<SharedFunctionInfo> shared_function_info,
-                            Handle<BytecodeArray> bytecode);
+                            Handle<BytecodeArray> bytecode,
+                            Handle<internal::FeedbackVector> feedback_vector =
+                                Handle<internal::FeedbackVector>());
 
   void GenerateCode();
   MaybeHandle<Code> Build(LocalIsolate* local_isolate);
@@ -110,6 +113,9 @@ class BaselineCompiler {
 
   // Feedback vector.
   MemOperand FeedbackVector();
+  // Returns the field handler of a monomorphic named load whose field load
+  // can be inlined, based on the feedback at compile time.
+  bool TryGetMonomorphicFieldLoad(FeedbackSlot slot, Tagged<Smi>* handler);
   void LoadFeedbackVector(Register output);
   void LoadClosureFeedbackArray(Register output);
 
@@ -166,6 +172,9 @@ class BaselineCompiler {
   Handle<SharedFunctionInfo> shared_function_info_;
   Handle<HeapObject> interpreter_data_;
   Handle<BytecodeArray> bytecode_;
+  // The feedback vector of the closure being compiled, if any. Only available
+  // when compiling on the main thread.
+  Handle<internal::FeedbackVector> feedback_vector_;
   MacroAssembler masm_;
   BaselineAssembler basm_;
   interpreter::BytecodeArrayIterator iterator_;
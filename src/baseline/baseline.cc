@@ -54,11 +54,13 @@ bool CanCompileWithBaseline(Isolate* isolate,
 }
 
 MaybeHandle<Code> GenerateBaselineCode(Isolate* isolate,
-                                       Handle<SharedFunctionInfo> shared) {
+                                       Handle<SharedFunctionInfo> shared,
+                                       Handle<FeedbackVector> feedback_vector) {
   RCS_SCOPE(isolate, RuntimeCallCounterId::kCompileBaseline);
   Handle<BytecodeArray> bytecode(shared->GetBytecodeArray(isolate), isolate);
   LocalIsolate* local_isolate = isolate->main_thread_local_isolate();
-  baseline::BaselineCompiler compiler(local_isolate, shared, bytecode);
+  baseline::BaselineCompiler compiler(local_isolate, shared, bytecode,
+                                      feedback_vector);
   compiler.GenerateCode();
   MaybeHandle<Code> code = compiler.Build(local_isolate);
   if (v8_flags.print_code && !code.is_null()) {
@@ -85,7 +87,8 @@ bool CanCompileWithBaseline(Isolate* isolate,
 }
 
 MaybeHandle<Code> GenerateBaselineCode(Isolate* isolate,
-                                       Handle<SharedFunctionInfo> shared) {
+                                       Handle<SharedFunctionInfo> shared,
+                                       Handle<FeedbackVector> feedback_vector) {
   UNREACHABLE();
 }
 
@@ -11,14 +11,16 @@ namespace v8 {
 namespace internal {
 
 class Code;
+class FeedbackVector;
 class SharedFunctionInfo;
 class MacroAssembler;
 
 bool CanCompileWithBaseline(Isolate* isolate,
                             Tagged<SharedFunctionInfo> shared);
 
-MaybeHandle<Code> GenerateBaselineCode(Isolate* isolate,
-                                       Handle<SharedFunctionInfo> shared);
+MaybeHandle<Code> GenerateBaselineCode(
+    Isolate* isolate, Handle<SharedFunctionInfo> shared,
+    Handle<FeedbackVector> feedback_vector = Handle<FeedbackVector>());
 
 void EmitReturnBaseline(MacroAssembler* masm);
 
@@ -177,6 +177,11 @@ void BaselineAssembler::JumpIfSmi(Condition cc, Register lhs, Register rhs,
   __ cmp(lhs, rhs);
   __ j(cc, target, distance);
 }
+void BaselineAssembler::JumpIfTagged(Condition cc, Register lhs, Register rhs,
+                                     Label* target, Label::Distance distance) {
+  __ cmp(lhs, rhs);
+  __ j(cc, target, distance);
+}
 void BaselineAssembler::JumpIfTagged(Condition cc, Register value,
                                      MemOperand operand, Label* target,
                                      Label::Distance distance) {
@@ -330,6 +335,11 @@ void BaselineAssembler::LoadWord16FieldZeroExtend(Register output,
   __ movzx_w(output, FieldOperand(source, offset));
 }
 
+void BaselineAssembler::LoadWeakValue(Register in_out,
+                                      Label* target_if_cleared) {
+  __ LoadWeakValue(in_out, target_if_cleared);
+}
+
 void BaselineAssembler::LoadWord8Field(Register output, Register source,
                                        int offset) {
   __ mov_b(output, FieldOperand(source, offset));
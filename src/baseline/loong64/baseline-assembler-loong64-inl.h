@@ -163,6 +163,10 @@ void BaselineAssembler::JumpIfSmi(Condition cc, Register lhs, Register rhs,
   __ AssertSmi(rhs);
   __ CompareTaggedAndBranch(target, cc, lhs, Operand(rhs));
 }
+void BaselineAssembler::JumpIfTagged(Condition cc, Register lhs, Register rhs,
+                                     Label* target, Label::Distance) {
+  __ CompareTaggedAndBranch(target, cc, lhs, Operand(rhs));
+}
 void BaselineAssembler::JumpIfTagged(Condition cc, Register value,
                                      MemOperand operand, Label* target,
                                      Label::Distance) {
@@ -337,6 +341,10 @@ void BaselineAssembler::LoadWord16FieldZeroExtend(Register output,
                                                   Register source, int offset) {
   __ Ld_hu(output, FieldMemOperand(source, offset));
 }
+void BaselineAssembler::LoadWeakValue(Register in_out,
+                                      Label* target_if_cleared) {
+  __ LoadWeakValue(in_out, in_out, target_if_cleared);
+}
 void BaselineAssembler::LoadWord8Field(Register output, Register source,
                                        int offset) {
   __ Ld_b(output, FieldMemOperand(source, offset));
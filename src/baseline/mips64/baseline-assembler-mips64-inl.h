@@ -159,6 +159,10 @@ void BaselineAssembler::JumpIfSmi(Condition cc, Register lhs, Register rhs,
   __ AssertSmi(rhs);
   __ Branch(target, cc, lhs, Operand(rhs));
 }
+void BaselineAssembler::JumpIfTagged(Condition cc, Register lhs, Register rhs,
+                                     Label* target, Label::Distance) {
+  __ Branch(target, cc, lhs, Operand(rhs));
+}
 void BaselineAssembler::JumpIfTagged(Condition cc, Register value,
                                      MemOperand operand, Label* target,
                                      Label::Distance) {
@@ -333,6 +337,10 @@ void BaselineAssembler::LoadWord16FieldZeroExtend(Register output,
                                                   Register source, int offset) {
   __ Lhu(output, FieldMemOperand(source, offset));
 }
+void BaselineAssembler::LoadWeakValue(Register in_out,
+                                      Label* target_if_cleared) {
+  __ LoadWeakValue(in_out, in_out, target_if_cleared);
+}
 void BaselineAssembler::LoadWord8Field(Register output, Register source,
                                        int offset) {
   __ Lb(output, FieldMemOperand(source, offset));
@@ -219,6 +219,12 @@ constexpr static int stack_bias = 4;
 constexpr static int stack_bias = 0;
 #endif
 
+void BaselineAssembler::JumpIfTagged(Condition cc, Register lhs, Register rhs,
+                                     Label* target, Label::Distance) {
+  ASM_CODE_COMMENT(masm_);
+  JumpIfHelper<COMPRESS_POINTERS_BOOL ? 32 : 64>(masm_, cc, lhs, rhs, target);
+}
+
 void BaselineAssembler::JumpIfTagged(Condition cc, Register value,
                                      MemOperand operand, Label* target,
                                      Label::Distance) {
@@ -428,6 +434,11 @@ void BaselineAssembler::LoadWord16FieldZeroExtend(Register output,
   __ LoadU16(output, FieldMemOperand(source, offset));
 }
 
+void BaselineAssembler::LoadWeakValue(Register in_out,
+                                      Label* target_if_cleared) {
+  __ LoadWeakValue(in_out, in_out, target_if_cleared);
+}
+
 void BaselineAssembler::LoadWord8Field(Register output, Register source,
                                        int offset) {
   ASM_CODE_COMMENT(masm_);
@@ -189,6 +189,11 @@ void BaselineAssembler::JumpIfImmediate(Condition cc, Register left, int right,
 }
 
 // cmp_tagged
+void BaselineAssembler::JumpIfTagged(Condition cc, Register lhs, Register rhs,
+                                     Label* target, Label::Distance distance) {
+  __ cmp_tagged(lhs, rhs);
+  __ j(cc, target, distance);
+}
 void BaselineAssembler::JumpIfTagged(Condition cc, Register value,
                                      MemOperand operand, Label* target,
                                      Label::Distance distance) {
@@ -338,6 +343,10 @@ void BaselineAssembler::LoadWord16FieldZeroExtend(Register output,
                                                   Register source, int offset) {
   __ movzxwq(output, FieldOperand(source, offset));
 }
+void BaselineAssembler::LoadWeakValue(Register in_out,
+                                      Label* target_if_cleared) {
+  __ LoadWeakValue(in_out, target_if_cleared);
+}
 void BaselineAssembler::LoadWord8Field(Register output, Register source,
                                        int offset) {
   __ movb(output, FieldOperand(source, offset));
@@ -139,6 +139,12 @@ TF_BUILTIN(AsyncFunctionEnter, AsyncFunctionBuiltinsAssembler) {
       parameters_and_registers);
   StoreObjectFieldNoWriteBarrier(
       async_function_object, JSAsyncFunctionObject::kPromiseOffset, promise);
+  StoreObjectFieldRoot(async_function_object,
+                       JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+                       RootIndex::kUndefinedValue);
+  StoreObjectFieldRoot(async_function_object,
+                       JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+                       RootIndex::kUndefinedValue);
 
   // While we are executing an async function, we need to have the implicit
   // promise on the stack to get the catch prediction right, even before we
@@ -237,14 +243,74 @@ void AsyncFunctionBuiltinsAssembler::AsyncFunctionAwait(
   auto value = Parameter<Object>(Descriptor::kValue);
   auto context = Parameter<Context>(Descriptor::kContext);
 
-  TNode<SharedFunctionInfo> on_resolve_sfi =
-      AsyncFunctionAwaitResolveSharedFunConstant();
-  TNode<SharedFunctionInfo> on_reject_sfi =
-      AsyncFunctionAwaitRejectSharedFunConstant();
+  const TNode<NativeContext> native_context = LoadNativeContext(context);
   TNode<JSPromise> outer_promise = LoadObjectField<JSPromise>(
       async_function_object, JSAsyncFunctionObject::kPromiseOffset);
-  Await(context, async_function_object, value, outer_promise, on_resolve_sfi,
-        on_reject_sfi, is_predicted_as_caught);
+  const TNode<JSPromise> promise =
+      AwaitedPromise(native_context, value, outer_promise);
+
+  // Unlike the other awaits, the resume closures of async functions are
+  // cached on the async function object and reused, so that only the first
+  // await allocates the resolve closure.
+  TVARIABLE(JSFunction, var_on_resolve);
+  {
+    Label if_allocate_on_resolve(this), if_on_resolve_done(this);
+    const TNode<Object> maybe_on_resolve =
+        LoadObjectField(async_function_object,
+                        JSAsyncFunctionObject::kAwaitResolveClosureOffset);
+    GotoIf(IsUndefined(maybe_on_resolve), &if_allocate_on_resolve);
+    var_on_resolve = CAST(maybe_on_resolve);
+    Goto(&if_on_resolve_done);
+
+    BIND(&if_allocate_on_resolve);
+    {
+      const TNode<Context> closure_context =
+          AllocateAwaitContext(native_context, async_function_object);
+      var_on_resolve =
+          AllocateNativeClosure(closure_context, native_context,
+                                AsyncFunctionAwaitResolveSharedFunConstant());
+      StoreObjectField(async_function_object,
+                       JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+                       var_on_resolve.value());
+      Goto(&if_on_resolve_done);
+    }
+
+    BIND(&if_on_resolve_done);
+  }
+
+  // The reject closure is only allocated by the first await that needs it,
+  // so awaiting fulfilled promises doesn't allocate it at all.
+  TVARIABLE(Object, var_on_reject, UndefinedConstant());
+  {
+    Label if_needs_on_reject(this), if_on_reject_done(this);
+    BranchIfAwaitNeedsRejectClosure(promise, &if_needs_on_reject,
+                                    &if_on_reject_done);
+
+    BIND(&if_needs_on_reject);
+    {
+      var_on_reject =
+          LoadObjectField(async_function_object,
+                          JSAsyncFunctionObject::kAwaitRejectClosureOffset);
+      GotoIfNot(IsUndefined(var_on_reject.value()), &if_on_reject_done);
+
+      // Share the await context with the resolve closure.
+      const TNode<Context> closure_context = LoadObjectField<Context>(
+          var_on_resolve.value(), JSFunction::kContextOffset);
+      var_on_reject =
+          AllocateNativeClosure(closure_context, native_context,
+                                AsyncFunctionAwaitRejectSharedFunConstant());
+      StoreObjectField(async_function_object,
+                       JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+                       var_on_reject.value());
+      Goto(&if_on_reject_done);
+    }
+
+    BIND(&if_on_reject_done);
+  }
+
+  PerformAwait(native_context, async_function_object, promise, outer_promise,
+               var_on_resolve.value(), var_on_reject.value(),
+               BooleanConstant(is_predicted_as_caught));
 
   // Return outer promise to avoid adding an load of the outer promise before
   // suspending in BytecodeGenerator.
@@ -6,6 +6,7 @@
 
 #include "src/builtins/builtins-utils-gen.h"
 #include "src/heap/factory-inl.h"
+#include "src/logging/counters.h"
 #include "src/objects/js-generator.h"
 #include "src/objects/js-promise.h"
 #include "src/objects/shared-function-info.h"
@@ -22,100 +23,149 @@ class ValueUnwrapContext {
 
 }  // namespace
 
-TNode<Object> AsyncBuiltinsAssembler::Await(
-    TNode<Context> context, TNode<JSGeneratorObject> generator,
-    TNode<Object> value, TNode<JSPromise> outer_promise,
-    TNode<SharedFunctionInfo> on_resolve_sfi,
-    TNode<SharedFunctionInfo> on_reject_sfi,
-    TNode<Boolean> is_predicted_as_caught) {
-  const TNode<NativeContext> native_context = LoadNativeContext(context);
-
+TNode<JSPromise> AsyncBuiltinsAssembler::AwaitedPromise(
+    TNode<NativeContext> native_context, TNode<Object> value,
+    TNode<JSPromise> outer_promise) {
   // We do the `PromiseResolve(%Promise%,value)` avoiding to unnecessarily
   // create wrapper promises. Now if {value} is already a promise with the
   // intrinsics %Promise% constructor as its "constructor", we don't need
   // to allocate the wrapper promise.
-  {
-    TVARIABLE(Object, var_value, value);
-    Label if_slow_path(this, Label::kDeferred), if_done(this),
-        if_slow_constructor(this, Label::kDeferred);
-    GotoIf(TaggedIsSmi(value), &if_slow_path);
-    TNode<HeapObject> value_object = CAST(value);
-    const TNode<Map> value_map = LoadMap(value_object);
-    GotoIfNot(IsJSPromiseMap(value_map), &if_slow_path);
-    // We can skip the "constructor" lookup on {value} if it's [[Prototype]]
-    // is the (initial) Promise.prototype and the @@species protector is
-    // intact, as that guards the lookup path for "constructor" on
-    // JSPromise instances which have the (initial) Promise.prototype.
-    const TNode<Object> promise_prototype =
-        LoadContextElement(native_context, Context::PROMISE_PROTOTYPE_INDEX);
-    GotoIfNot(TaggedEqual(LoadMapPrototype(value_map), promise_prototype),
-              &if_slow_constructor);
-    Branch(IsPromiseSpeciesProtectorCellInvalid(), &if_slow_constructor,
-           &if_done);
-
-    // At this point, {value} doesn't have the initial promise prototype or
-    // the promise @@species protector was invalidated, but {value} could still
-    // have the %Promise% as its "constructor", so we need to check that as
-    // well.
-    BIND(&if_slow_constructor);
-    {
-      const TNode<Object> value_constructor = GetProperty(
-          context, value, isolate()->factory()->constructor_string());
-      const TNode<Object> promise_function =
-          LoadContextElement(native_context, Context::PROMISE_FUNCTION_INDEX);
-      Branch(TaggedEqual(value_constructor, promise_function), &if_done,
-             &if_slow_path);
-    }
+  TVARIABLE(Object, var_value, value);
+  Label if_slow_path(this, Label::kDeferred), if_done(this),
+      if_slow_constructor(this, Label::kDeferred);
+  GotoIf(TaggedIsSmi(value), &if_slow_path);
+  TNode<HeapObject> value_object = CAST(value);
+  const TNode<Map> value_map = LoadMap(value_object);
+  GotoIfNot(IsJSPromiseMap(value_map), &if_slow_path);
+  // We can skip the "constructor" lookup on {value} if it's [[Prototype]]
+  // is the (initial) Promise.prototype and the @@species protector is
+  // intact, as that guards the lookup path for "constructor" on
+  // JSPromise instances which have the (initial) Promise.prototype.
+  const TNode<Object> promise_prototype =
+      LoadContextElement(native_context, Context::PROMISE_PROTOTYPE_INDEX);
+  GotoIfNot(TaggedEqual(LoadMapPrototype(value_map), promise_prototype),
+            &if_slow_constructor);
+  Branch(IsPromiseSpeciesProtectorCellInvalid(), &if_slow_constructor,
+         &if_done);
 
-    BIND(&if_slow_path);
-    {
-      // We need to mark the {value} wrapper as having {outer_promise}
-      // as its parent, which is why we need to inline a good chunk of
-      // logic from the `PromiseResolve` builtin here.
-      var_value = NewJSPromise(native_context, outer_promise);
-      CallBuiltin(Builtin::kResolvePromise, native_context, var_value.value(),
-                  value);
-      Goto(&if_done);
-    }
+  // At this point, {value} doesn't have the initial promise prototype or
+  // the promise @@species protector was invalidated, but {value} could still
+  // have the %Promise% as its "constructor", so we need to check that as
+  // well.
+  BIND(&if_slow_constructor);
+  {
+    const TNode<Object> value_constructor = GetProperty(
+        native_context, value, isolate()->factory()->constructor_string());
+    const TNode<Object> promise_function =
+        LoadContextElement(native_context, Context::PROMISE_FUNCTION_INDEX);
+    Branch(TaggedEqual(value_constructor, promise_function), &if_done,
+           &if_slow_path);
+  }
 
-    BIND(&if_done);
-    value = var_value.value();
+  BIND(&if_slow_path);
+  {
+    // We need to mark the {value} wrapper as having {outer_promise}
+    // as its parent, which is why we need to inline a good chunk of
+    // logic from the `PromiseResolve` builtin here.
+    var_value = NewJSPromise(native_context, outer_promise);
+    CallBuiltin(Builtin::kResolvePromise, native_context, var_value.value(),
+                value);
+    Goto(&if_done);
   }
 
+  BIND(&if_done);
+  return CAST(var_value.value());
+}
+
+TNode<Context> AsyncBuiltinsAssembler::AllocateAwaitContext(
+    TNode<NativeContext> native_context, TNode<JSGeneratorObject> generator) {
   static const int kClosureContextSize =
       FixedArray::SizeFor(Context::MIN_CONTEXT_EXTENDED_SLOTS);
   TNode<Context> closure_context =
       UncheckedCast<Context>(AllocateInNewSpace(kClosureContextSize));
+  // Initialize the await context, storing the {generator} as extension.
+  TNode<Map> map = CAST(
+      LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
+  StoreMapNoWriteBarrier(closure_context, map);
+  StoreObjectFieldNoWriteBarrier(
+      closure_context, Context::kLengthOffset,
+      SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
+  const TNode<Object> empty_scope_info =
+      LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
+  StoreContextElementNoWriteBarrier(closure_context, Context::SCOPE_INFO_INDEX,
+                                    empty_scope_info);
+  StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
+                                    native_context);
+  StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
+                                    generator);
+  return closure_context;
+}
+
+TNode<JSFunction> AsyncBuiltinsAssembler::AllocateNativeClosure(
+    TNode<Context> context, TNode<NativeContext> native_context,
+    TNode<SharedFunctionInfo> shared_info) {
+  TNode<HeapObject> function =
+      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
+  InitializeNativeClosure(context, native_context, function, shared_info);
+  return CAST(function);
+}
+
+TNode<Object> AsyncBuiltinsAssembler::Await(
+    TNode<Context> context, TNode<JSGeneratorObject> generator,
+    TNode<Object> value, TNode<JSPromise> outer_promise,
+    TNode<SharedFunctionInfo> on_resolve_sfi,
+    TNode<SharedFunctionInfo> on_reject_sfi,
+    TNode<Boolean> is_predicted_as_caught) {
+  const TNode<NativeContext> native_context = LoadNativeContext(context);
+  const TNode<JSPromise> promise =
+      AwaitedPromise(native_context, value, outer_promise);
+
+  // Allocate and initialize resolve handler
+  const TNode<Context> closure_context =
+      AllocateAwaitContext(native_context, generator);
+  const TNode<JSFunction> on_resolve =
+      AllocateNativeClosure(closure_context, native_context, on_resolve_sfi);
+
+  // Allocate and initialize reject handler, if it is needed at all.
+  TVARIABLE(Object, var_on_reject, UndefinedConstant());
   {
-    // Initialize the await context, storing the {generator} as extension.
-    TNode<Map> map = CAST(
-        LoadContextElement(native_context, Context::AWAIT_CONTEXT_MAP_INDEX));
-    StoreMapNoWriteBarrier(closure_context, map);
-    StoreObjectFieldNoWriteBarrier(
-        closure_context, Context::kLengthOffset,
-        SmiConstant(Context::MIN_CONTEXT_EXTENDED_SLOTS));
-    const TNode<Object> empty_scope_info =
-        LoadContextElement(native_context, Context::SCOPE_INFO_INDEX);
-    StoreContextElementNoWriteBarrier(
-        closure_context, Context::SCOPE_INFO_INDEX, empty_scope_info);
-    StoreContextElementNoWriteBarrier(closure_context, Context::PREVIOUS_INDEX,
-                                      native_context);
-    StoreContextElementNoWriteBarrier(closure_context, Context::EXTENSION_INDEX,
-                                      generator);
+    Label if_allocate_on_reject(this), if_on_reject_done(this);
+    BranchIfAwaitNeedsRejectClosure(promise, &if_allocate_on_reject,
+                                    &if_on_reject_done);
+
+    BIND(&if_allocate_on_reject);
+    {
+      var_on_reject =
+          AllocateNativeClosure(closure_context, native_context, on_reject_sfi);
+      Goto(&if_on_reject_done);
+    }
+
+    BIND(&if_on_reject_done);
   }
 
-  // Allocate and initialize resolve handler
-  TNode<HeapObject> on_resolve =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_resolve,
-                          on_resolve_sfi);
+  return PerformAwait(native_context, generator, promise, outer_promise,
+                      on_resolve, var_on_reject.value(),
+                      is_predicted_as_caught);
+}
 
-  // Allocate and initialize reject handler
-  TNode<HeapObject> on_reject =
-      AllocateInNewSpace(JSFunction::kSizeWithoutPrototype);
-  InitializeNativeClosure(closure_context, native_context, on_reject,
-                          on_reject_sfi);
+void AsyncBuiltinsAssembler::BranchIfAwaitNeedsRejectClosure(
+    TNode<JSPromise> promise, Label* if_needed, Label* if_not_needed) {
+  GotoIf(IsIsolatePromiseHookEnabledOrDebugIsActiveOrHasAsyncEventDelegate(),
+         if_needed);
+  const TNode<Int32T> promise_flags =
+      SmiToInt32(LoadObjectField<Smi>(promise, JSPromise::kFlagsOffset));
+  GotoIfNot(Word32Equal(DecodeWord32<JSPromise::StatusBits>(promise_flags),
+                        Int32Constant(Promise::kFulfilled)),
+            if_needed);
+  IncrementCounter(isolate()->counters()->awaits_on_fulfilled_promises(), 1);
+  Goto(if_not_needed);
+}
 
+TNode<Object> AsyncBuiltinsAssembler::PerformAwait(
+    TNode<NativeContext> native_context, TNode<JSGeneratorObject> generator,
+    TNode<JSPromise> promise, TNode<JSPromise> outer_promise,
+    TNode<JSFunction> on_resolve, TNode<Object> on_reject,
+    TNode<Boolean> is_predicted_as_caught) {
   // Deal with PromiseHooks and debug support in the runtime. This
   // also allocates the throwaway promise, which is only needed in
   // case of PromiseHooks or debugging.
@@ -133,19 +183,19 @@ TNode<Object> AsyncBuiltinsAssembler::Await(
   // passed into Builtin::kPerformPromiseThen below.
   GotoIfNot(IsContextPromiseHookEnabled(promiseHookFlags),
             &if_instrumentation_done);
-  var_throwaway = NewJSPromise(context, value);
+  var_throwaway = NewJSPromise(native_context, promise);
 #endif  // V8_ENABLE_JAVASCRIPT_PROMISE_HOOKS
   Goto(&if_instrumentation_done);
   BIND(&if_instrumentation);
   {
     var_throwaway = CallRuntime(Runtime::kDebugAsyncFunctionSuspended,
-                                native_context, value, outer_promise, on_reject,
-                                generator, is_predicted_as_caught);
+                                native_context, promise, outer_promise,
+                                on_reject, generator, is_predicted_as_caught);
     Goto(&if_instrumentation_done);
   }
   BIND(&if_instrumentation_done);
 
-  return CallBuiltin(Builtin::kPerformPromiseThen, native_context, value,
+  return CallBuiltin(Builtin::kPerformPromiseThen, native_context, promise,
                      on_resolve, on_reject, var_throwaway.value());
 }
 
@@ -37,6 +37,38 @@ class AsyncBuiltinsAssembler : public PromiseBuiltinsAssembler {
                  on_reject_sfi, BooleanConstant(is_predicted_as_caught));
   }
 
+  // The steps of Await above, for callers that create the closures themselves,
+  // e.g. to reuse them across awaits.
+
+  // Returns `PromiseResolve(%Promise%, value)`, avoiding the wrapper promise
+  // if {value} is a native promise already.
+  TNode<JSPromise> AwaitedPromise(TNode<NativeContext> native_context,
+                                  TNode<Object> value,
+                                  TNode<JSPromise> outer_promise);
+  // If {promise} is already fulfilled, PerformPromiseThen never looks at the
+  // reject closure, unless the debugger or a PromiseHook gets to see it, so
+  // it doesn't need to be created.
+  void BranchIfAwaitNeedsRejectClosure(TNode<JSPromise> promise,
+                                       Label* if_needed,
+                                       Label* if_not_needed);
+  // Deals with instrumentation and subscribes the closures to {promise}.
+  // {on_reject} may be undefined if {promise} is known to be fulfilled.
+  TNode<Object> PerformAwait(TNode<NativeContext> native_context,
+                             TNode<JSGeneratorObject> generator,
+                             TNode<JSPromise> promise,
+                             TNode<JSPromise> outer_promise,
+                             TNode<JSFunction> on_resolve,
+                             TNode<Object> on_reject,
+                             TNode<Boolean> is_predicted_as_caught);
+
+  // Allocates the context of the await closures, which holds the {generator}
+  // as its extension.
+  TNode<Context> AllocateAwaitContext(TNode<NativeContext> native_context,
+                                      TNode<JSGeneratorObject> generator);
+  TNode<JSFunction> AllocateNativeClosure(
+      TNode<Context> context, TNode<NativeContext> native_context,
+      TNode<SharedFunctionInfo> shared_info);
+
   // Return a new built-in function object as defined in
   // Async Iterator Value Unwrap Functions
   TNode<JSFunction> CreateUnwrapClosure(TNode<NativeContext> native_context,
@@ -4235,6 +4235,8 @@ TNode<NameDictionary> CodeStubAssembler::AllocateNameDictionaryWithCapacity(
     StoreFixedArrayElement(result, NameDictionary::kFlagsIndex,
                            SmiConstant(NameDictionary::kFlagsDefault),
                            SKIP_WRITE_BARRIER);
+    StoreFixedArrayElement(result, NameDictionary::kEnumKeysCacheIndex,
+                           UndefinedConstant(), SKIP_WRITE_BARRIER);
   }
 
   // Initialize NameDictionary elements.
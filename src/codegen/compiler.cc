@@ -578,6 +578,8 @@ void TurbofanCompilationJob::RecordCompilationStats(ConcurrencyMode mode,
     counters->turbofan_osr_finalize()->AddSample(
         static_cast<int>(time_taken_to_finalize_.InMicroseconds()));
     counters->turbofan_osr_total_time()->AddSample(elapsed_microseconds);
+    counters->turbofan_osr_queue_wait()->AddSample(
+        static_cast<int>(time_in_queue_.InMicroseconds()));
     return;
   }
 
@@ -599,6 +601,8 @@ void TurbofanCompilationJob::RecordCompilationStats(ConcurrencyMode mode,
       time_background += time_taken_to_execute_;
       counters->turbofan_optimize_concurrent_total_time()->AddSample(
           elapsed_microseconds);
+      counters->turbofan_optimize_queue_wait()->AddSample(
+          static_cast<int>(time_in_queue_.InMicroseconds()));
       break;
     case ConcurrencyMode::kSynchronous:
       counters->turbofan_optimize_non_concurrent_total_time()->AddSample(
@@ -1121,7 +1125,11 @@ bool CompileTurbofan_Concurrent(Isolate* isolate,
   DCHECK_EQ(compilation_info->code_kind(), CodeKind::TURBOFAN);
   Handle<JSFunction> function = compilation_info->closure();
 
-  if (!isolate->optimizing_compile_dispatcher()->IsQueueAvailable()) {
+  OptimizingCompileDispatcher* dispatcher =
+      isolate->optimizing_compile_dispatcher();
+  if (!dispatcher->IsQueueAvailable()) dispatcher->DropStaleJobs();
+  // OSR jobs may evict a queued job below, once they are prepared.
+  if (!dispatcher->IsQueueAvailable() && !compilation_info->is_osr()) {
     if (v8_flags.trace_concurrent_recompilation) {
       PrintF("  ** Compilation queue full, will retry optimizing ");
       ShortPrint(*function);
@@ -1150,8 +1158,18 @@ bool CompileTurbofan_Concurrent(Isolate* isolate,
     return false;
   }
 
+  // Only evict a queued job when the OSR job is ready to take its place.
+  if (!dispatcher->IsQueueAvailable() && !dispatcher->EvictForOsr()) {
+    if (v8_flags.trace_concurrent_recompilation) {
+      PrintF("  ** Compilation queue full, will retry optimizing ");
+      ShortPrint(*function);
+      PrintF(" later.\n");
+    }
+    return false;
+  }
+
   // The background recompile will own this job.
-  isolate->optimizing_compile_dispatcher()->QueueForOptimization(job.release());
+  dispatcher->QueueForOptimization(job.release());
 
   if (v8_flags.trace_concurrent_recompilation) {
     PrintF("  ** Queued ");
@@ -2748,10 +2766,10 @@ bool Compiler::Compile(Isolate* isolate, Handle<JSFunction> function,
 }
 
 // static
-bool Compiler::CompileSharedWithBaseline(Isolate* isolate,
-                                         Handle<SharedFunctionInfo> shared,
-                                         Compiler::ClearExceptionFlag flag,
-                                         IsCompiledScope* is_compiled_scope) {
+bool Compiler::CompileSharedWithBaseline(
+    Isolate* isolate, Handle<SharedFunctionInfo> shared,
+    Compiler::ClearExceptionFlag flag, IsCompiledScope* is_compiled_scope,
+    Handle<FeedbackVector> feedback_vector) {
   // We shouldn't be passing uncompiled functions into this function.
   DCHECK(is_compiled_scope->is_compiled());
 
@@ -2776,7 +2794,8 @@ bool Compiler::CompileSharedWithBaseline(Isolate* isolate,
     base::ScopedTimer timer(
         v8_flags.trace_baseline || v8_flags.log_function_events ? &time_taken
                                                                 : nullptr);
-    if (!GenerateBaselineCode(isolate, shared).ToHandle(&code)) {
+    if (!GenerateBaselineCode(isolate, shared, feedback_vector)
+             .ToHandle(&code)) {
       // TODO(leszeks): This can only fail because of an OOM. Do we want to
       // report these somehow, or silently ignore them?
       return false;
@@ -2803,7 +2822,12 @@ bool Compiler::CompileBaseline(Isolate* isolate, Handle<JSFunction> function,
                                ClearExceptionFlag flag,
                                IsCompiledScope* is_compiled_scope) {
   Handle<SharedFunctionInfo> shared(function->shared(isolate), isolate);
-  if (!CompileSharedWithBaseline(isolate, shared, flag, is_compiled_scope)) {
+  Handle<FeedbackVector> feedback_vector;
+  if (function->has_feedback_vector()) {
+    feedback_vector = handle(function->feedback_vector(), isolate);
+  }
+  if (!CompileSharedWithBaseline(isolate, shared, flag, is_compiled_scope,
+                                 feedback_vector)) {
     return false;
   }
 
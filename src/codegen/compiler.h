@@ -88,10 +88,12 @@ class V8_EXPORT_PRIVATE Compiler : public AllStatic {
       ParseInfo* parse_info, Handle<Script> script, Isolate* isolate,
       IsCompiledScope* is_compiled_scope);
 
-  static bool CompileSharedWithBaseline(Isolate* isolate,
-                                        Handle<SharedFunctionInfo> shared,
-                                        ClearExceptionFlag flag,
-                                        IsCompiledScope* is_compiled_scope);
+  // If a {feedback_vector} is given, the baseline code may specialize on the
+  // feedback that was collected in it so far.
+  static bool CompileSharedWithBaseline(
+      Isolate* isolate, Handle<SharedFunctionInfo> shared,
+      ClearExceptionFlag flag, IsCompiledScope* is_compiled_scope,
+      Handle<FeedbackVector> feedback_vector = Handle<FeedbackVector>());
   static bool CompileBaseline(Isolate* isolate, Handle<JSFunction> function,
                               ClearExceptionFlag flag,
                               IsCompiledScope* is_compiled_scope);
@@ -471,8 +473,13 @@ class TurbofanCompilationJob : public OptimizedCompilationJob {
   // Intended for use as a globally unique id in trace events.
   uint64_t trace_id() const;
 
+  // Time spent in the concurrent recompilation queue before a worker picked
+  // the job up. Set by the OptimizingCompileDispatcher.
+  void set_time_in_queue(base::TimeDelta time) { time_in_queue_ = time; }
+
  private:
   OptimizedCompilationInfo* const compilation_info_;
+  base::TimeDelta time_in_queue_;
 };
 
 class FinalizeUnoptimizedCompilationData {
@@ -58,18 +58,16 @@ const char* const
         // Isolate addresses:
         FOR_EACH_ISOLATE_ADDRESS_NAME(ADD_ISOLATE_ADDR)
         // Stub cache:
-        "Load StubCache::primary_->key",
-        "Load StubCache::primary_->value",
-        "Load StubCache::primary_->map",
+        "Load StubCache::primary_",
         "Load StubCache::secondary_->key",
         "Load StubCache::secondary_->value",
         "Load StubCache::secondary_->map",
-        "Store StubCache::primary_->key",
-        "Store StubCache::primary_->value",
-        "Store StubCache::primary_->map",
+        "Load StubCache::primary_mask_",
+        "Store StubCache::primary_",
         "Store StubCache::secondary_->key",
         "Store StubCache::secondary_->value",
         "Store StubCache::secondary_->map",
+        "Store StubCache::primary_mask_",
         // Native code counters:
         STATS_COUNTER_NATIVE_CODE_LIST(ADD_STATS_COUNTER_NAME)
 };
@@ -294,12 +292,11 @@ void ExternalReferenceTable::AddStubCache(Isolate* isolate, int* index) {
                                         isolate->define_own_stub_cache()};
 
   for (StubCache* stub_cache : stub_caches) {
-    Add(stub_cache->key_reference(StubCache::kPrimary).address(), index);
-    Add(stub_cache->value_reference(StubCache::kPrimary).address(), index);
-    Add(stub_cache->map_reference(StubCache::kPrimary).address(), index);
+    Add(stub_cache->primary_table_reference().address(), index);
     Add(stub_cache->key_reference(StubCache::kSecondary).address(), index);
     Add(stub_cache->value_reference(StubCache::kSecondary).address(), index);
     Add(stub_cache->map_reference(StubCache::kSecondary).address(), index);
+    Add(stub_cache->primary_mask_reference().address(), index);
   }
 
   CHECK_EQ(kSizeIsolateIndependent + kExternalReferenceCountIsolateDependent +
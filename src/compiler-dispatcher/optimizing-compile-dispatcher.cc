@@ -15,7 +15,7 @@
 #include "src/logging/counters.h"
 #include "src/logging/log.h"
 #include "src/logging/runtime-call-stats-scope.h"
-#include "src/objects/js-function.h"
+#include "src/objects/js-function-inl.h"
 #include "src/tasks/cancelable-task.h"
 #include "src/tracing/trace-event.h"
 
@@ -41,7 +41,9 @@ class OptimizingCompileDispatcher::CompileTask : public v8::JobTask {
 
       TimerEventScope<TimerEventRecompileConcurrent> timer(isolate_);
       while (!delegate->ShouldYield()) {
-        TurbofanCompilationJob* job = dispatcher_->NextInput(&local_isolate);
+        bool is_large = false;
+        TurbofanCompilationJob* job =
+            dispatcher_->NextInput(&local_isolate, &is_large);
         if (!job) break;
         TRACE_EVENT_WITH_FLOW0(
             TRACE_DISABLED_BY_DEFAULT("v8.compile"), "V8.OptimizeBackground",
@@ -53,13 +55,14 @@ class OptimizingCompileDispatcher::CompileTask : public v8::JobTask {
               dispatcher_->recompilation_delay_));
         }
 
-        dispatcher_->CompileNext(job, &local_isolate);
+        dispatcher_->CompileNext(job, is_large, &local_isolate);
       }
     }
   }
 
   size_t GetMaxConcurrency(size_t worker_count) const override {
-    size_t num_tasks = dispatcher_->input_queue_.Length() + worker_count;
+    size_t num_tasks =
+        dispatcher_->input_queue_.RunnableLength() + worker_count;
     size_t max_threads = v8_flags.concurrent_turbofan_max_threads;
     if (max_threads > 0) {
       return std::min(max_threads, num_tasks);
@@ -83,11 +86,12 @@ OptimizingCompileDispatcher::~OptimizingCompileDispatcher() {
 }
 
 TurbofanCompilationJob* OptimizingCompileDispatcher::NextInput(
-    LocalIsolate* local_isolate) {
-  return input_queue_.Dequeue();
+    LocalIsolate* local_isolate, bool* is_large) {
+  return input_queue_.Dequeue(is_large);
 }
 
 void OptimizingCompileDispatcher::CompileNext(TurbofanCompilationJob* job,
+                                              bool is_large,
                                               LocalIsolate* local_isolate) {
   if (!job) return;
 
@@ -96,6 +100,12 @@ void OptimizingCompileDispatcher::CompileNext(TurbofanCompilationJob* job,
       job->ExecuteJob(local_isolate->runtime_call_stats(), local_isolate);
   USE(status);  // Prevent an unused-variable error.
 
+  if (is_large) {
+    // Large jobs that were held back may be picked up now.
+    input_queue_.LargeJobFinished();
+    job_handle_->NotifyConcurrencyIncrease();
+  }
+
   {
     // The function may have already been optimized by OSR.  Simply continue.
     // Use a mutex to make sure that functions marked for install
@@ -107,6 +117,101 @@ void OptimizingCompileDispatcher::CompileNext(TurbofanCompilationJob* job,
   if (finalize()) isolate_->stack_guard()->RequestInstallCode();
 }
 
+TurbofanCompilationJob* OptimizingCompileDispatcherQueue::Dequeue(
+    bool* is_large) {
+  base::MutexGuard access(&mutex_);
+  int index = 0;
+  if (!CanStartLargeJob()) {
+    while (index < length_ && queue_[QueueIndex(index)].is_large) index++;
+  }
+  if (index == length_) return nullptr;
+  Entry entry = RemoveAt(index);
+  DCHECK_NOT_NULL(entry.job);
+  if (entry.is_large) {
+    pending_large_jobs_--;
+    running_large_jobs_++;
+  }
+  entry.job->set_time_in_queue(base::TimeTicks::Now() - entry.enqueued_at);
+  *is_large = entry.is_large;
+  return entry.job;
+}
+
+void OptimizingCompileDispatcherQueue::Enqueue(TurbofanCompilationJob* job,
+                                               bool is_large) {
+  base::MutexGuard access(&mutex_);
+  DCHECK_LT(length_, capacity_);
+  int index = length_;
+  if (job->compilation_info()->is_osr()) {
+    // Insert behind the OSR jobs already at the front of the queue.
+    index = CountLeadingOsrJobs();
+    for (int i = length_; i > index; --i) {
+      queue_[QueueIndex(i)] = queue_[QueueIndex(i - 1)];
+    }
+  }
+  queue_[QueueIndex(index)] = {job, is_large, base::TimeTicks::Now()};
+  length_++;
+  if (is_large) pending_large_jobs_++;
+}
+
+TurbofanCompilationJob*
+OptimizingCompileDispatcherQueue::EvictNewestNonOsrJob() {
+  base::MutexGuard access(&mutex_);
+  for (int i = length_ - 1; i >= 0; --i) {
+    if (queue_[QueueIndex(i)].job->compilation_info()->is_osr()) continue;
+    Entry entry = RemoveAt(i);
+    if (entry.is_large) pending_large_jobs_--;
+    return entry.job;
+  }
+  return nullptr;
+}
+
+namespace {
+
+bool IsStale(TurbofanCompilationJob* job) {
+  OptimizedCompilationInfo* info = job->compilation_info();
+  Tagged<JSFunction> function = *info->closure();
+  if (!function->has_feedback_vector()) return true;
+  return !IsInProgress(info->is_osr() ? function->osr_tiering_state()
+                                      : function->tiering_state());
+}
+
+}  // namespace
+
+void OptimizingCompileDispatcherQueue::RemoveStaleJobs(
+    std::vector<TurbofanCompilationJob*>* stale_jobs) {
+  base::MutexGuard access(&mutex_);
+  for (int i = length_ - 1; i >= 0; --i) {
+    if (!IsStale(queue_[QueueIndex(i)].job)) continue;
+    Entry entry = RemoveAt(i);
+    if (entry.is_large) pending_large_jobs_--;
+    stale_jobs->push_back(entry.job);
+  }
+}
+
+OptimizingCompileDispatcherQueue::Entry
+OptimizingCompileDispatcherQueue::RemoveAt(int index) {
+  mutex_.AssertHeld();
+  DCHECK_LT(index, length_);
+  Entry entry = queue_[QueueIndex(index)];
+  // Close the gap by moving the entries in front of it back by one.
+  for (int i = index; i > 0; --i) {
+    queue_[QueueIndex(i)] = queue_[QueueIndex(i - 1)];
+  }
+  shift_ = QueueIndex(1);
+  length_--;
+  return entry;
+}
+
+int OptimizingCompileDispatcherQueue::CountLeadingOsrJobs() {
+  mutex_.AssertHeld();
+  int count = 0;
+  while (count < length_ &&
+         queue_[QueueIndex(count)].job->compilation_info()->is_osr()) {
+    count++;
+  }
+  return count;
+}
+
 void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
   for (;;) {
     std::unique_ptr<TurbofanCompilationJob> job;
@@ -125,12 +230,13 @@ void OptimizingCompileDispatcher::FlushOutputQueue(bool restore_function_code) {
 void OptimizingCompileDispatcherQueue::Flush(Isolate* isolate) {
   base::MutexGuard access(&mutex_);
   while (length_ > 0) {
-    std::unique_ptr<TurbofanCompilationJob> job(queue_[QueueIndex(0)]);
+    std::unique_ptr<TurbofanCompilationJob> job(queue_[QueueIndex(0)].job);
     DCHECK_NOT_NULL(job);
     shift_ = QueueIndex(1);
     length_--;
     Compiler::DisposeTurbofanCompilationJob(isolate, job.get(), true);
   }
+  pending_large_jobs_ = 0;
 }
 
 void OptimizingCompileDispatcher::FlushInputQueue() {
@@ -213,10 +319,27 @@ bool OptimizingCompileDispatcher::HasJobs() {
   return job_handle_->IsActive() || !output_queue_.empty();
 }
 
+bool OptimizingCompileDispatcher::IsLargeJob(
+    TurbofanCompilationJob* job) const {
+  if (large_bytecode_size_ <= 0) return false;
+  OptimizedCompilationInfo* info = job->compilation_info();
+  // OSR jobs are latency sensitive and never held back.
+  if (info->is_osr() || !info->has_bytecode_array()) return false;
+  return info->bytecode_array()->length() >= large_bytecode_size_;
+}
+
 void OptimizingCompileDispatcher::QueueForOptimization(
     TurbofanCompilationJob* job) {
   DCHECK(input_queue_.IsAvailable());
-  input_queue_.Enqueue(job);
+  bool is_large = IsLargeJob(job);
+  if (is_large && v8_flags.trace_concurrent_recompilation) {
+    PrintF("  ** Queueing large function ");
+    ShortPrint(*job->compilation_info()->closure());
+    PrintF(" for concurrent recompilation.\n");
+  }
+  isolate_->counters()->turbofan_optimize_queue_length()->AddSample(
+      input_queue_.Length());
+  input_queue_.Enqueue(job, is_large);
   if (job_handle_->UpdatePriorityEnabled()) {
     job_handle_->UpdatePriority(isolate_->UseEfficiencyModeForTiering()
                                     ? kEfficiencyTaskPriority
@@ -228,11 +351,13 @@ void OptimizingCompileDispatcher::QueueForOptimization(
 void OptimizingCompileDispatcherQueue::Prioritize(
     Tagged<SharedFunctionInfo> function) {
   base::MutexGuard access(&mutex_);
-  if (length_ > 1) {
-    for (int i = length_ - 1; i > 1; --i) {
-      if (*queue_[QueueIndex(i)]->compilation_info()->shared_info() ==
+  // Never move a regular job ahead of queued OSR jobs.
+  int front = CountLeadingOsrJobs();
+  if (length_ - front > 1) {
+    for (int i = length_ - 1; i > front + 1; --i) {
+      if (*queue_[QueueIndex(i)].job->compilation_info()->shared_info() ==
           function) {
-        std::swap(queue_[QueueIndex(i)], queue_[QueueIndex(0)]);
+        std::swap(queue_[QueueIndex(i)], queue_[QueueIndex(front)]);
         return;
       }
     }
@@ -244,10 +369,46 @@ void OptimizingCompileDispatcher::Prioritize(
   input_queue_.Prioritize(function);
 }
 
+bool OptimizingCompileDispatcher::EvictForOsr() {
+  std::unique_ptr<TurbofanCompilationJob> job(
+      input_queue_.EvictNewestNonOsrJob());
+  if (!job) return false;
+  HandleScope handle_scope(isolate_);
+  if (v8_flags.trace_concurrent_recompilation) {
+    PrintF("  ** Evicting ");
+    ShortPrint(*job->compilation_info()->closure());
+    PrintF(" from the compilation queue to make room for OSR.\n");
+  }
+  isolate_->counters()->turbofan_optimize_jobs_evicted()->Increment();
+  Compiler::DisposeTurbofanCompilationJob(isolate_, job.get(), false);
+  return true;
+}
+
+void OptimizingCompileDispatcher::DropStaleJobs() {
+  DCHECK_EQ(ThreadId::Current(), isolate_->thread_id());
+  std::vector<TurbofanCompilationJob*> stale_jobs;
+  input_queue_.RemoveStaleJobs(&stale_jobs);
+  if (stale_jobs.empty()) return;
+  HandleScope handle_scope(isolate_);
+  for (TurbofanCompilationJob* stale_job : stale_jobs) {
+    std::unique_ptr<TurbofanCompilationJob> job(stale_job);
+    if (v8_flags.trace_concurrent_recompilation) {
+      PrintF("  ** Dropping stale job for ");
+      ShortPrint(*job->compilation_info()->closure());
+      PrintF(" from the compilation queue.\n");
+    }
+    isolate_->counters()->turbofan_optimize_jobs_dropped()->Increment();
+    // The tiering state no longer belongs to this job and may hold a new
+    // request for the function, so it is left alone.
+  }
+}
+
 OptimizingCompileDispatcher::OptimizingCompileDispatcher(Isolate* isolate)
     : isolate_(isolate),
-      input_queue_(v8_flags.concurrent_recompilation_queue_length),
-      recompilation_delay_(v8_flags.concurrent_recompilation_delay) {
+      input_queue_(v8_flags.concurrent_recompilation_queue_length,
+                   v8_flags.concurrent_turbofan_max_large_jobs),
+      recompilation_delay_(v8_flags.concurrent_recompilation_delay),
+      large_bytecode_size_(v8_flags.concurrent_turbofan_large_bytecode_size) {
   if (v8_flags.concurrent_recompilation) {
     job_handle_ = V8::GetCurrentPlatform()->PostJob(
         kTaskPriority, std::make_unique<CompileTask>(isolate, this));
@@ -7,9 +7,11 @@
 
 #include <atomic>
 #include <queue>
+#include <vector>
 
 #include "src/base/platform/condition-variable.h"
 #include "src/base/platform/mutex.h"
+#include "src/base/platform/time.h"
 #include "src/common/globals.h"
 #include "src/flags/flags.h"
 #include "src/heap/parked-scope.h"
@@ -24,6 +26,17 @@ class RuntimeCallStats;
 class SharedFunctionInfo;
 
 // Circular queue of incoming recompilation tasks (including OSR).
+//
+// Jobs for functions with very large bytecode are tagged as "large" on
+// enqueue. The queue keeps track of how many large jobs are currently being
+// compiled so that a handful of huge functions cannot occupy every worker
+// thread; while the limit is reached, workers skip over pending large jobs
+// and keep draining the rest of the queue.
+//
+// OSR jobs are queued ahead of all regular jobs (but behind earlier OSR
+// jobs), since the function is stuck in a long-running loop until they
+// finish. Jobs that went stale while waiting, e.g. because their function
+// deoptimized, are dropped before they start.
 class V8_EXPORT OptimizingCompileDispatcherQueue {
  public:
   inline bool IsAvailable() {
@@ -36,28 +49,48 @@ class V8_EXPORT OptimizingCompileDispatcherQueue {
     return length_;
   }
 
-  explicit OptimizingCompileDispatcherQueue(int capacity)
-      : capacity_(capacity), length_(0), shift_(0) {
-    queue_ = NewArray<TurbofanCompilationJob*>(capacity_);
+  // Number of queued jobs that a worker could pick up right now, i.e. not
+  // counting large jobs that are held back by {max_running_large_jobs}.
+  inline int RunnableLength() {
+    base::MutexGuard access_queue(&mutex_);
+    if (CanStartLargeJob()) return length_;
+    return length_ - pending_large_jobs_;
   }
 
+  OptimizingCompileDispatcherQueue(int capacity, int max_running_large_jobs)
+      : capacity_(capacity),
+        length_(0),
+        shift_(0),
+        max_running_large_jobs_(max_running_large_jobs) {
+    queue_ = NewArray<Entry>(capacity_);
+  }
+  explicit OptimizingCompileDispatcherQueue(int capacity)
+      : OptimizingCompileDispatcherQueue(capacity, 0) {}
+
   ~OptimizingCompileDispatcherQueue() { DeleteArray(queue_); }
 
-  TurbofanCompilationJob* Dequeue() {
-    base::MutexGuard access(&mutex_);
-    if (length_ == 0) return nullptr;
-    TurbofanCompilationJob* job = queue_[QueueIndex(0)];
-    DCHECK_NOT_NULL(job);
-    shift_ = QueueIndex(1);
-    length_--;
-    return job;
-  }
+  // Returns the oldest job that may be started. Large jobs are skipped while
+  // {max_running_large_jobs} of them are being compiled. {is_large} is set to
+  // whether the returned job counts against that limit, in which case the
+  // caller must call {LargeJobFinished} once it is done compiling it.
+  TurbofanCompilationJob* Dequeue(bool* is_large);
+
+  void Enqueue(TurbofanCompilationJob* job, bool is_large = false);
+
+  // Removes the most recently queued non-OSR job, which has waited the least
+  // and is the cheapest to re-request later. Returns nullptr if there is no
+  // such job.
+  TurbofanCompilationJob* EvictNewestNonOsrJob();
 
-  void Enqueue(TurbofanCompilationJob* job) {
+  // Removes the jobs whose function no longer waits for them, i.e. it lost its
+  // feedback vector or its tiering state was reset (e.g. by a deopt), and
+  // appends them to {stale_jobs}. Must be called on the main thread.
+  void RemoveStaleJobs(std::vector<TurbofanCompilationJob*>* stale_jobs);
+
+  void LargeJobFinished() {
     base::MutexGuard access(&mutex_);
-    DCHECK_LT(length_, capacity_);
-    queue_[QueueIndex(length_)] = job;
-    length_++;
+    DCHECK_LT(0, running_large_jobs_);
+    running_large_jobs_--;
   }
 
   void Flush(Isolate* isolate);
@@ -65,6 +98,12 @@ class V8_EXPORT OptimizingCompileDispatcherQueue {
   void Prioritize(Tagged<SharedFunctionInfo> function);
 
  private:
+  struct Entry {
+    TurbofanCompilationJob* job;
+    bool is_large;
+    base::TimeTicks enqueued_at;
+  };
+
   inline int QueueIndex(int i) {
     int result = (i + shift_) % capacity_;
     DCHECK_LE(0, result);
@@ -72,10 +111,26 @@ class V8_EXPORT OptimizingCompileDispatcherQueue {
     return result;
   }
 
-  TurbofanCompilationJob** queue_;
+  // Removes the entry at logical position {index}, keeping the order of the
+  // remaining entries.
+  Entry RemoveAt(int index);
+
+  // Number of OSR jobs at the front of the queue.
+  int CountLeadingOsrJobs();
+
+  bool CanStartLargeJob() const {
+    mutex_.AssertHeld();
+    return max_running_large_jobs_ <= 0 ||
+           running_large_jobs_ < max_running_large_jobs_;
+  }
+
+  Entry* queue_;
   int capacity_;
   int length_;
   int shift_;
+  int pending_large_jobs_ = 0;
+  int running_large_jobs_ = 0;
+  const int max_running_large_jobs_;
   base::Mutex mutex_;
 };
 
@@ -110,6 +165,16 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
 
   void Prioritize(Tagged<SharedFunctionInfo> function);
 
+  // Makes room for an OSR job in a full queue by discarding the youngest
+  // regular job. Its function can request optimization again later. Returns
+  // whether a job was discarded.
+  bool EvictForOsr();
+
+  // Discards the queued jobs that are stale, before a worker picks them up.
+  // Their result would not be used, since the function already gave up on
+  // them, and they take up room in the queue.
+  void DropStaleJobs();
+
  private:
   class CompileTask;
 
@@ -122,8 +187,11 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
                    bool restore_function_code);
   void FlushInputQueue();
   void FlushOutputQueue(bool restore_function_code);
-  void CompileNext(TurbofanCompilationJob* job, LocalIsolate* local_isolate);
-  TurbofanCompilationJob* NextInput(LocalIsolate* local_isolate);
+  void CompileNext(TurbofanCompilationJob* job, bool is_large,
+                   LocalIsolate* local_isolate);
+  TurbofanCompilationJob* NextInput(LocalIsolate* local_isolate,
+                                    bool* is_large);
+  bool IsLargeJob(TurbofanCompilationJob* job) const;
 
   Isolate* isolate_;
 
@@ -144,6 +212,9 @@ class V8_EXPORT_PRIVATE OptimizingCompileDispatcher {
   // is not safe to access them directly.
   int recompilation_delay_;
 
+  // Copy of v8_flags.concurrent_turbofan_large_bytecode_size, see above.
+  int large_bytecode_size_;
+
   bool finalize_ = true;
 };
 }  // namespace internal
@@ -381,6 +381,26 @@ FieldAccess AccessBuilder::ForJSAsyncFunctionObjectPromise() {
   return access;
 }
 
+// static
+FieldAccess AccessBuilder::ForJSAsyncFunctionObjectAwaitResolveClosure() {
+  FieldAccess access = {
+      kTaggedBase,         JSAsyncFunctionObject::kAwaitResolveClosureOffset,
+      Handle<Name>(),      OptionalMapRef(),
+      Type::NonInternal(), MachineType::AnyTagged(),
+      kFullWriteBarrier,   "JSAsyncFunctionObjectAwaitResolveClosure"};
+  return access;
+}
+
+// static
+FieldAccess AccessBuilder::ForJSAsyncFunctionObjectAwaitRejectClosure() {
+  FieldAccess access = {
+      kTaggedBase,         JSAsyncFunctionObject::kAwaitRejectClosureOffset,
+      Handle<Name>(),      OptionalMapRef(),
+      Type::NonInternal(), MachineType::AnyTagged(),
+      kFullWriteBarrier,   "JSAsyncFunctionObjectAwaitRejectClosure"};
+  return access;
+}
+
 // static
 FieldAccess AccessBuilder::ForJSAsyncGeneratorObjectQueue() {
   FieldAccess access = {
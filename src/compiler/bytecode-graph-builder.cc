@@ -333,6 +333,15 @@ class BytecodeGraphBuilder {
   void BuildJumpIfJSReceiver();
   void BuildJumpIfForInDone();
 
+  // Derives a hint for the branch of the current conditional jump from the
+  // feedback collected in its two successors. The jump is taken if the branch
+  // condition is {jump_if}.
+  BranchHint BranchHintFromFeedback(bool jump_if);
+  enum class ArmFeedback { kUnknown, kNeverExecuted, kExecuted };
+  // Looks at the first bytecode carrying IC feedback that is reached by
+  // straight-line execution from {offset}, and returns whether it has run.
+  ArmFeedback GetArmFeedback(int offset);
+
   void BuildSwitchOnSmi(Node* condition);
   void BuildSwitchOnGeneratorState(
       const ZoneVector<ResumeJumpTarget>& resume_jump_targets,
@@ -4071,8 +4080,97 @@ void BytecodeGraphBuilder::BuildJump() {
   MergeIntoSuccessorEnvironment(bytecode_iterator().GetJumpTargetOffset());
 }
 
+BytecodeGraphBuilder::ArmFeedback BytecodeGraphBuilder::GetArmFeedback(
+    int offset) {
+  // Only look at the beginning of the arm, the first IC is usually close. The
+  // builder's own iterator is moved there and back, since a new iterator would
+  // register a GC epilogue callback for every branch.
+  static constexpr int kMaxBytecodesToScan = 8;
+  interpreter::BytecodeArrayIterator& it = bytecode_iterator();
+  const int current_offset = it.current_offset();
+  ArmFeedback result = ArmFeedback::kUnknown;
+  it.SetOffset(offset);
+  for (int i = 0; i < kMaxBytecodesToScan && !it.done(); ++i, it.Advance()) {
+    interpreter::Bytecode bytecode = it.current_bytecode();
+    if (interpreter::Bytecodes::IsJump(bytecode) ||
+        interpreter::Bytecodes::IsSwitch(bytecode) ||
+        interpreter::Bytecodes::Returns(bytecode) ||
+        interpreter::Bytecodes::UnconditionallyThrows(bytecode)) {
+      break;
+    }
+    switch (bytecode) {
+      case interpreter::Bytecode::kGetNamedProperty:
+      case interpreter::Bytecode::kGetKeyedProperty:
+      case interpreter::Bytecode::kLdaGlobal:
+      case interpreter::Bytecode::kLdaGlobalInsideTypeof:
+      case interpreter::Bytecode::kCallAnyReceiver:
+      case interpreter::Bytecode::kCallProperty:
+      case interpreter::Bytecode::kCallProperty0:
+      case interpreter::Bytecode::kCallProperty1:
+      case interpreter::Bytecode::kCallProperty2:
+      case interpreter::Bytecode::kCallUndefinedReceiver:
+      case interpreter::Bytecode::kCallUndefinedReceiver0:
+      case interpreter::Bytecode::kCallUndefinedReceiver1:
+      case interpreter::Bytecode::kCallUndefinedReceiver2:
+      case interpreter::Bytecode::kConstruct:
+      case interpreter::Bytecode::kAdd:
+      case interpreter::Bytecode::kSub:
+      case interpreter::Bytecode::kMul:
+      case interpreter::Bytecode::kDiv:
+      case interpreter::Bytecode::kMod:
+      case interpreter::Bytecode::kAddSmi:
+      case interpreter::Bytecode::kSubSmi:
+      case interpreter::Bytecode::kMulSmi:
+      case interpreter::Bytecode::kInc:
+      case interpreter::Bytecode::kDec:
+      case interpreter::Bytecode::kTestEqual:
+      case interpreter::Bytecode::kTestEqualStrict:
+      case interpreter::Bytecode::kTestLessThan:
+      case interpreter::Bytecode::kTestGreaterThan:
+      case interpreter::Bytecode::kTestLessThanOrEqual:
+      case interpreter::Bytecode::kTestGreaterThanOrEqual:
+        break;
+      default:
+        continue;
+    }
+    // All bytecodes above take their feedback slot as the last operand. Only
+    // uninitialized feedback shows that the arm never ran: feedback that is
+    // insufficient because its maps were cleared or deprecated was collected
+    // by an arm that did run.
+    int slot_operand = interpreter::Bytecodes::NumberOfOperands(bytecode) - 1;
+    FeedbackSource source =
+        CreateFeedbackSource(it.GetSlotOperand(slot_operand));
+    FeedbackNexus nexus(source.vector, source.slot,
+                        broker()->feedback_nexus_config());
+    result = nexus.IsUninitialized() ? ArmFeedback::kNeverExecuted
+                                     : ArmFeedback::kExecuted;
+    break;
+  }
+  it.SetOffset(current_offset);
+  DCHECK_EQ(it.current_offset(), current_offset);
+  return result;
+}
+
+BranchHint BytecodeGraphBuilder::BranchHintFromFeedback(bool jump_if) {
+  if (!v8_flags.turbo_branch_hints_from_feedback) return BranchHint::kNone;
+  ArmFeedback jump =
+      GetArmFeedback(bytecode_iterator().GetJumpTargetOffset());
+  ArmFeedback fallthrough = GetArmFeedback(bytecode_iterator().next_offset());
+  // Only hint if we have positive evidence that the other arm has run, so
+  // that branches in code that never ran at all are left alone.
+  if (jump == ArmFeedback::kNeverExecuted &&
+      fallthrough == ArmFeedback::kExecuted) {
+    return jump_if ? BranchHint::kFalse : BranchHint::kTrue;
+  }
+  if (fallthrough == ArmFeedback::kNeverExecuted &&
+      jump == ArmFeedback::kExecuted) {
+    return jump_if ? BranchHint::kTrue : BranchHint::kFalse;
+  }
+  return BranchHint::kNone;
+}
+
 void BytecodeGraphBuilder::BuildJumpIf(Node* condition) {
-  NewBranch(condition, BranchHint::kNone);
+  NewBranch(condition, BranchHintFromFeedback(true));
   {
     SubEnvironment sub_environment(this);
     NewIfTrue();
@@ -4082,7 +4180,7 @@ void BytecodeGraphBuilder::BuildJumpIf(Node* condition) {
 }
 
 void BytecodeGraphBuilder::BuildJumpIfNot(Node* condition) {
-  NewBranch(condition, BranchHint::kNone);
+  NewBranch(condition, BranchHintFromFeedback(false));
   {
     SubEnvironment sub_environment(this);
     NewIfFalse();
@@ -4106,7 +4204,7 @@ void BytecodeGraphBuilder::BuildJumpIfNotEqual(Node* comperand) {
 }
 
 void BytecodeGraphBuilder::BuildJumpIfFalse() {
-  NewBranch(environment()->LookupAccumulator(), BranchHint::kNone);
+  NewBranch(environment()->LookupAccumulator(), BranchHintFromFeedback(false));
   {
     SubEnvironment sub_environment(this);
     NewIfFalse();
@@ -4118,7 +4216,7 @@ void BytecodeGraphBuilder::BuildJumpIfFalse() {
 }
 
 void BytecodeGraphBuilder::BuildJumpIfTrue() {
-  NewBranch(environment()->LookupAccumulator(), BranchHint::kNone);
+  NewBranch(environment()->LookupAccumulator(), BranchHintFromFeedback(true));
   {
     SubEnvironment sub_environment(this);
     NewIfTrue();
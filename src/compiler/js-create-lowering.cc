@@ -810,6 +810,10 @@ Reduction JSCreateLowering::ReduceJSCreateAsyncFunctionObject(Node* node) {
   a.Store(AccessBuilder::ForJSGeneratorObjectParametersAndRegisters(),
           parameters_and_registers);
   a.Store(AccessBuilder::ForJSAsyncFunctionObjectPromise(), promise);
+  a.Store(AccessBuilder::ForJSAsyncFunctionObjectAwaitResolveClosure(),
+          jsgraph()->UndefinedConstant());
+  a.Store(AccessBuilder::ForJSAsyncFunctionObjectAwaitRejectClosure(),
+          jsgraph()->UndefinedConstant());
   a.FinishAndChange(node);
   return Changed(node);
 }
@@ -1392,11 +1396,13 @@ Reduction JSCreateLowering::ReduceJSCreateObject(Node* node) {
     // Initialize NameDictionary fields.
     a.Store(AccessBuilder::ForNameDictionaryFlagsIndex(),
             jsgraph()->SmiConstant(NameDictionary::kFlagsDefault));
-    // Initialize the Properties fields.
+    // Initialize the enum keys cache and the Properties fields.
     Node* undefined = jsgraph()->UndefinedConstant();
-    static_assert(NameDictionary::kElementsStartIndex ==
+    static_assert(NameDictionary::kEnumKeysCacheIndex ==
                   NameDictionary::kFlagsIndex + 1);
-    for (int index = NameDictionary::kElementsStartIndex; index < length;
+    static_assert(NameDictionary::kElementsStartIndex ==
+                  NameDictionary::kEnumKeysCacheIndex + 1);
+    for (int index = NameDictionary::kEnumKeysCacheIndex; index < length;
          index++) {
       a.Store(AccessBuilder::ForFixedArraySlot(index, kNoWriteBarrier),
               undefined);
@@ -57,6 +57,14 @@ bool HasOnlyJSArrayMaps(JSHeapBroker* broker, ZoneVector<MapRef> const& maps) {
   return true;
 }
 
+bool HasOnlyJSProxyMaps(ZoneVector<MapRef> const& maps) {
+  if (maps.empty()) return false;
+  for (MapRef map : maps) {
+    if (!map.IsJSProxyMap()) return false;
+  }
+  return true;
+}
+
 }  // namespace
 
 JSNativeContextSpecialization::JSNativeContextSpecialization(
@@ -1469,6 +1477,93 @@ Reduction JSNativeContextSpecialization::ReduceMegaDOMPropertyAccess(
   return Replace(value);
 }
 
+Reduction JSNativeContextSpecialization::ReduceProxyAccess(
+    Node* node, Node* value, NameRef name, AccessMode access_mode, Node* key,
+    ZoneVector<MapRef> const& proxy_maps) {
+  // Private symbols are stored on the proxy itself.
+  if (name.object()->IsPrivate()) return NoChange();
+
+  Builtin builtin;
+  switch (access_mode) {
+    case AccessMode::kLoad:
+      if (node->opcode() == IrOpcode::kJSLoadNamedFromSuper) return NoChange();
+      builtin = Builtin::kProxyGetProperty;
+      break;
+    case AccessMode::kStore:
+      if (node->opcode() != IrOpcode::kJSSetNamedProperty &&
+          node->opcode() != IrOpcode::kJSSetKeyedProperty) {
+        return NoChange();
+      }
+      builtin = Builtin::kProxySetProperty;
+      break;
+    case AccessMode::kHas:
+      builtin = Builtin::kProxyHasProperty;
+      break;
+    case AccessMode::kStoreInLiteral:
+    case AccessMode::kDefine:
+      return NoChange();
+  }
+
+  Node* receiver = NodeProperties::GetValueInput(node, 0);
+  Node* context = NodeProperties::GetContextInput(node);
+  FrameState frame_state{NodeProperties::GetFrameStateInput(node)};
+  Effect effect{NodeProperties::GetEffectInput(node)};
+  Control control{NodeProperties::GetControlInput(node)};
+
+  PropertyAccessBuilder access_builder(jsgraph(), broker());
+  access_builder.BuildCheckMaps(receiver, &effect, control, proxy_maps);
+  if (key != nullptr) {
+    effect = BuildCheckEqualsName(name, key, effect, control);
+  }
+
+  // Call the proxy builtin directly instead of going through the IC, which
+  // would only dispatch to the same builtin after checking the feedback.
+  Callable callable = Builtins::CallableFor(isolate(), builtin);
+  CallDescriptor* call_descriptor = Linkage::GetStubCallDescriptor(
+      graph()->zone(), callable.descriptor(),
+      callable.descriptor().GetStackParameterCount(),
+      CallDescriptor::kNeedsFrameState, Operator::kNoProperties);
+  Node* stub_code = jsgraph()->HeapConstantNoHole(callable.code());
+  Node* name_node = jsgraph()->ConstantNoHole(name, broker());
+  Node* call;
+  switch (builtin) {
+    case Builtin::kProxyGetProperty:
+      value = call = graph()->NewNode(
+          common()->Call(call_descriptor), stub_code, receiver, name_node,
+          receiver,
+          jsgraph()->SmiConstant(
+              static_cast<int>(OnNonExistent::kReturnUndefined)),
+          context, frame_state, effect, control);
+      break;
+    case Builtin::kProxySetProperty:
+      call = graph()->NewNode(common()->Call(call_descriptor), stub_code,
+                              receiver, name_node, value, receiver, context,
+                              frame_state, effect, control);
+      break;
+    case Builtin::kProxyHasProperty:
+      value = call = graph()->NewNode(
+          common()->Call(call_descriptor), stub_code, receiver, name_node,
+          context, frame_state, effect, control);
+      break;
+    default:
+      UNREACHABLE();
+  }
+  effect = call;
+  control = call;
+
+  // Rewire potential exception edges.
+  Node* on_exception = nullptr;
+  if (NodeProperties::IsExceptionalCall(node, &on_exception)) {
+    Node* if_exception =
+        graph()->NewNode(common()->IfException(), effect, control);
+    ReplaceWithValue(on_exception, if_exception, if_exception, if_exception);
+    control = graph()->NewNode(common()->IfSuccess(), control);
+  }
+
+  ReplaceWithValue(node, value, effect, control);
+  return Replace(value);
+}
+
 Reduction JSNativeContextSpecialization::ReduceNamedAccess(
     Node* node, Node* value, NamedAccessFeedback const& feedback,
     AccessMode access_mode, Node* key) {
@@ -1541,6 +1636,12 @@ Reduction JSNativeContextSpecialization::ReduceNamedAccess(
     }
   }
 
+  // Accesses that only ever saw proxies go straight to the proxy builtins.
+  if (HasOnlyJSProxyMaps(inferred_maps)) {
+    return ReduceProxyAccess(node, value, feedback.name(), access_mode, key,
+                             inferred_maps);
+  }
+
   ZoneVector<PropertyAccessInfo> access_infos(zone());
   {
     ZoneVector<PropertyAccessInfo> access_infos_for_feedback(zone());
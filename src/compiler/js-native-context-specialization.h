@@ -110,6 +110,9 @@ class V8_EXPORT_PRIVATE JSNativeContextSpecialization final
   Reduction ReduceMegaDOMPropertyAccess(
       Node* node, Node* value, MegaDOMPropertyAccessFeedback const& feedback,
       FeedbackSource const& source);
+  Reduction ReduceProxyAccess(Node* node, Node* value, NameRef name,
+                              AccessMode access_mode, Node* key,
+                              ZoneVector<MapRef> const& proxy_maps);
   Reduction ReduceGlobalAccess(Node* node, Node* lookup_start_object,
                                Node* receiver, Node* value, NameRef name,
                                AccessMode access_mode, Node* key,
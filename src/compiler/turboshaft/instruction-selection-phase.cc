@@ -251,7 +251,50 @@ ZoneVector<uint32_t> TurboshaftSpecialRPONumberer::ComputeBlockPermutation(
   return result;
 }
 
+namespace {
+
+// Returns true if all paths starting at {block} end in a deoptimization or in
+// unreachable code (e.g. after a throwing call), assuming that this has already
+// been computed for the forward successors of {block} and stored in their
+// kDeferredInSchedule custom data.
+bool EndsInColdExit(const Block& block, const Graph& graph) {
+  if (block.IsLoop()) return false;
+  const Operation& terminator = block.LastOperation(graph);
+  switch (terminator.opcode) {
+    case Opcode::kDeoptimize:
+    case Opcode::kUnreachable:
+      return true;
+    case Opcode::kGoto: {
+      const GotoOp& gto = terminator.Cast<GotoOp>();
+      if (gto.is_backedge) return false;
+      return gto.destination->get_custom_data(
+          Block::CustomDataKind::kDeferredInSchedule);
+    }
+    case Opcode::kBranch: {
+      const BranchOp& branch = terminator.Cast<BranchOp>();
+      return branch.if_true->get_custom_data(
+                 Block::CustomDataKind::kDeferredInSchedule) &&
+             branch.if_false->get_custom_data(
+                 Block::CustomDataKind::kDeferredInSchedule);
+    }
+    default:
+      return false;
+  }
+}
+
+}  // namespace
+
 void PropagateDeferred(Graph& graph) {
+  // Backward pass: find the blocks that can only reach cold exits. Blocks are
+  // in RPO, so all forward successors of a block have been visited before it.
+  // The custom data temporarily holds this information and is overwritten by
+  // the forward pass below.
+  for (Block& block : base::Reversed(graph.blocks())) {
+    block.set_custom_data(v8_flags.turboshaft_defer_cold_exits &&
+                              EndsInColdExit(block, graph),
+                          Block::CustomDataKind::kDeferredInSchedule);
+  }
+
   graph.StartBlock().set_custom_data(
       0, Block::CustomDataKind::kDeferredInSchedule);
   for (Block& block : graph.blocks()) {
@@ -269,11 +312,16 @@ void PropagateDeferred(Graph& graph) {
     } else if (predecessor->NeighboringPredecessor() == nullptr) {
       // This block has only a single predecessor. Due to edge-split form, those
       // are the only blocks that can be the target of a branch-like op which
-      // might potentially provide a BranchHint to defer this block.
+      // might potentially provide a BranchHint to defer this block. Targets of
+      // a branch that inevitably lead to a cold exit are deferred as well, so
+      // that they are placed out of line even without a hint.
+      const bool ends_in_cold_exit =
+          block.get_custom_data(Block::CustomDataKind::kDeferredInSchedule) &&
+          predecessor->LastOperation(graph).Is<BranchOp>();
       const bool is_deferred =
           predecessor->get_custom_data(
               Block::CustomDataKind::kDeferredInSchedule) ||
-          IsUnlikelySuccessor(predecessor, &block, graph);
+          IsUnlikelySuccessor(predecessor, &block, graph) || ends_in_cold_exit;
       block.set_custom_data(is_deferred,
                             Block::CustomDataKind::kDeferredInSchedule);
     } else {
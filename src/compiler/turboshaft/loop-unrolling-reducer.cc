@@ -12,6 +12,11 @@ namespace v8::internal::compiler::turboshaft {
 void LoopUnrollingAnalyzer::DetectUnrollableLoops() {
   for (const auto& [start, info] : loop_finder_.LoopHeaders()) {
     if (!info.has_inner_loops) {
+      if (!PipelineData::Get().is_wasm() &&
+          info.op_count < kJSMaxElementLoopSizeForPartialUnrolling &&
+          IsElementLoop(start)) {
+        element_loops_.insert(start);
+      }
       int iter_count;
       if (CanFullyUnrollLoop(info, &iter_count)) {
         loop_iteration_count_.insert({start, iter_count});
@@ -23,6 +28,25 @@ void LoopUnrollingAnalyzer::DetectUnrollableLoops() {
   }
 }
 
+bool LoopUnrollingAnalyzer::IsElementLoop(const Block* loop_header) {
+  bool has_element_access = false;
+  for (const Block* block : loop_finder_.GetLoopBody(loop_header)) {
+    for (const Operation& op : input_graph_->operations(*block)) {
+      if (op.Is<CallOp>()) return false;
+      if (const LoadOp* load = op.TryCast<LoadOp>()) {
+        if (!load->kind.tagged_base && load->index().valid()) {
+          has_element_access = true;
+        }
+      } else if (const StoreOp* store = op.TryCast<StoreOp>()) {
+        if (!store->kind.tagged_base && store->index().valid()) {
+          has_element_access = true;
+        }
+      }
+    }
+  }
+  return has_element_access;
+}
+
 bool LoopUnrollingAnalyzer::CanFullyUnrollLoop(const LoopFinder::LoopInfo& info,
                                                int* iter_count) const {
   const Block* start = info.start;
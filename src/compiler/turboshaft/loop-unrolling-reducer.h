@@ -22,6 +22,11 @@ namespace v8::internal::compiler::turboshaft {
 // LoopUnrollingReducer fully unrolls small inner loops with a small
 // statically-computable number of iterations, partially unrolls other small
 // inner loops, and remove loops that we detect as always having 0 iterations.
+//
+// In JS, inner loops that only compute on raw (typed array) elements and don't
+// call out are given a larger partial unrolling budget: their bodies are
+// dominated by bounds checks and element loads/stores, which are the parts
+// that benefit most from being scheduled together across iterations.
 
 class StaticCanonicalForLoopMatcher {
   // In the context of this class, a "static canonical for-loop" is one of the
@@ -112,6 +117,7 @@ class LoopUnrollingAnalyzer {
         matcher_(*input_graph),
         loop_finder_(phase_zone, input_graph),
         loop_iteration_count_(phase_zone),
+        element_loops_(phase_zone),
         canonical_loop_matcher_(matcher_, kPartialUnrollingCount) {
     DetectUnrollableLoops();
   }
@@ -127,8 +133,10 @@ class LoopUnrollingAnalyzer {
   bool ShouldPartiallyUnrollLoop(const Block* loop_header) const {
     DCHECK(loop_header->IsLoop());
     auto info = loop_finder_.GetLoopInfo(loop_header);
-    return !info.has_inner_loops &&
-           info.op_count < kMaxLoopSizeForPartialUnrolling;
+    size_t max_size = element_loops_.count(loop_header)
+                          ? kJSMaxElementLoopSizeForPartialUnrolling
+                          : kMaxLoopSizeForPartialUnrolling;
+    return !info.has_inner_loops && info.op_count < max_size;
   }
 
   bool ShouldRemoveLoop(const Block* loop_header) const {
@@ -159,6 +167,7 @@ class LoopUnrollingAnalyzer {
   // function of the loop's size and a MaxLoopSize could make sense.
   static constexpr size_t kMaxLoopSizeForFullUnrolling = 150;
   static constexpr size_t kJSMaxLoopSizeForPartialUnrolling = 50;
+  static constexpr size_t kJSMaxElementLoopSizeForPartialUnrolling = 80;
   static constexpr size_t kWasmMaxLoopSizeForPartialUnrolling = 80;
   static constexpr size_t kMaxLoopIterationsForFullUnrolling = 4;
   static constexpr size_t kPartialUnrollingCount = 4;
@@ -167,6 +176,9 @@ class LoopUnrollingAnalyzer {
   void DetectUnrollableLoops();
   bool CanFullyUnrollLoop(const LoopFinder::LoopInfo& info,
                           int* iter_count) const;
+  // Returns true if the loop accesses raw memory elements (typically typed
+  // array backing stores) and contains no calls.
+  bool IsElementLoop(const Block* loop_header);
 
   Graph* input_graph_;
   OperationMatcher matcher_;
@@ -175,6 +187,8 @@ class LoopUnrollingAnalyzer {
   // doesn't contain entries for loops for which we don't know the number of
   // iterations.
   ZoneUnorderedMap<const Block*, int> loop_iteration_count_;
+  // Inner JS loops for which IsElementLoop holds.
+  ZoneUnorderedSet<const Block*> element_loops_;
   const StaticCanonicalForLoopMatcher canonical_loop_matcher_;
   const size_t kMaxLoopSizeForPartialUnrolling =
       PipelineData::Get().is_wasm() ? kWasmMaxLoopSizeForPartialUnrolling
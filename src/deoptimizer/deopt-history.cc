@@ -0,0 +1,182 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/deoptimizer/deopt-history.h"
+
+#include <algorithm>
+
+#include "src/execution/isolate.h"
+#include "src/handles/handles-inl.h"
+#include "src/interpreter/bytecode-array-iterator.h"
+#include "src/logging/counters.h"
+#include "src/objects/feedback-vector-inl.h"
+#include "src/objects/js-function-inl.h"
+#include "src/objects/script-inl.h"
+#include "src/objects/shared-function-info-inl.h"
+
+namespace v8 {
+namespace internal {
+
+// static
+base::Optional<uint64_t> DeoptHistory::KeyFor(
+    Tagged<SharedFunctionInfo> shared) {
+  // Don't hold on to the function itself, so that the history doesn't keep
+  // anything alive; the script id and function literal id identify it just as
+  // well.
+  if (!IsScript(shared->script())) return {};
+  uint32_t script_id =
+      static_cast<uint32_t>(Script::cast(shared->script())->id());
+  uint32_t literal_id = static_cast<uint32_t>(shared->function_literal_id());
+  return (static_cast<uint64_t>(script_id) << 32) | literal_id;
+}
+
+void DeoptHistory::RecordDeopt(Handle<JSFunction> function,
+                               BytecodeOffset bytecode_offset,
+                               DeoptimizeReason reason) {
+  base::Optional<uint64_t> key = KeyFor(function->shared());
+  if (!key.has_value()) return;
+  if (entries_.size() >= kMaxFunctions && entries_.count(*key) == 0) {
+    entries_.clear();
+  }
+  Entry& entry = entries_[*key];
+  entry.deopt_count++;
+
+  int offset = bytecode_offset.ToInt();
+  auto it = std::find_if(entry.sites.begin(), entry.sites.end(),
+                         [&](const Site& site) {
+                           return site.bytecode_offset == offset &&
+                                  site.reason == reason;
+                         });
+  if (it == entry.sites.end()) {
+    if (entry.sites.size() >= kMaxSitesPerFunction) return;
+    entry.sites.push_back({offset, reason, 0, false});
+    it = entry.sites.end() - 1;
+  }
+  Site& site = *it;
+  site.count++;
+
+  if (!v8_flags.deopt_loop_detection || site.speculation_disabled ||
+      site.count < v8_flags.deopt_loop_threshold) {
+    return;
+  }
+  isolate()->counters()->deopt_loops_detected()->Increment();
+  site.speculation_disabled = DisableSpeculationAt(function, offset);
+  if (v8_flags.trace_deopt_loops) {
+    StdoutStream{} << "[deopt loop in " << Brief(*function) << " at offset "
+                   << offset << " (" << DeoptimizeReasonToString(reason)
+                   << ", " << site.count << " deopts): "
+                   << (site.speculation_disabled
+                           ? "generalized feedback"
+                           : "no feedback to generalize")
+                   << "]" << std::endl;
+  }
+}
+
+const DeoptHistory::Entry* DeoptHistory::Get(
+    Tagged<SharedFunctionInfo> shared) const {
+  base::Optional<uint64_t> key = KeyFor(shared);
+  if (!key.has_value()) return nullptr;
+  auto it = entries_.find(*key);
+  if (it == entries_.end()) return nullptr;
+  return &it->second;
+}
+
+bool DeoptHistory::DisableSpeculationAt(Handle<JSFunction> function,
+                                        int bytecode_offset) {
+  if (!function->has_feedback_vector()) return false;
+  if (!function->shared()->HasBytecodeArray()) return false;
+  Handle<BytecodeArray> bytecode_array(
+      function->shared()->GetBytecodeArray(isolate()), isolate());
+  if (bytecode_offset < 0 || bytecode_offset >= bytecode_array->length()) {
+    return false;
+  }
+  interpreter::BytecodeArrayIterator it(bytecode_array, bytecode_offset);
+  interpreter::Bytecode bytecode = it.current_bytecode();
+
+  // All bytecodes below take their feedback slot as the last operand.
+  switch (bytecode) {
+    case interpreter::Bytecode::kGetNamedProperty:
+    case interpreter::Bytecode::kGetKeyedProperty:
+    case interpreter::Bytecode::kSetNamedProperty:
+    case interpreter::Bytecode::kSetKeyedProperty:
+    case interpreter::Bytecode::kCallAnyReceiver:
+    case interpreter::Bytecode::kCallProperty:
+    case interpreter::Bytecode::kCallProperty0:
+    case interpreter::Bytecode::kCallProperty1:
+    case interpreter::Bytecode::kCallProperty2:
+    case interpreter::Bytecode::kCallUndefinedReceiver:
+    case interpreter::Bytecode::kCallUndefinedReceiver0:
+    case interpreter::Bytecode::kCallUndefinedReceiver1:
+    case interpreter::Bytecode::kCallUndefinedReceiver2:
+    case interpreter::Bytecode::kConstruct:
+    case interpreter::Bytecode::kAdd:
+    case interpreter::Bytecode::kSub:
+    case interpreter::Bytecode::kMul:
+    case interpreter::Bytecode::kDiv:
+    case interpreter::Bytecode::kMod:
+    case interpreter::Bytecode::kExp:
+    case interpreter::Bytecode::kBitwiseOr:
+    case interpreter::Bytecode::kBitwiseXor:
+    case interpreter::Bytecode::kBitwiseAnd:
+    case interpreter::Bytecode::kShiftLeft:
+    case interpreter::Bytecode::kShiftRight:
+    case interpreter::Bytecode::kShiftRightLogical:
+    case interpreter::Bytecode::kAddSmi:
+    case interpreter::Bytecode::kSubSmi:
+    case interpreter::Bytecode::kMulSmi:
+    case interpreter::Bytecode::kDivSmi:
+    case interpreter::Bytecode::kModSmi:
+    case interpreter::Bytecode::kExpSmi:
+    case interpreter::Bytecode::kBitwiseOrSmi:
+    case interpreter::Bytecode::kBitwiseXorSmi:
+    case interpreter::Bytecode::kBitwiseAndSmi:
+    case interpreter::Bytecode::kShiftLeftSmi:
+    case interpreter::Bytecode::kShiftRightSmi:
+    case interpreter::Bytecode::kShiftRightLogicalSmi:
+    case interpreter::Bytecode::kInc:
+    case interpreter::Bytecode::kDec:
+    case interpreter::Bytecode::kNegate:
+    case interpreter::Bytecode::kTestEqual:
+    case interpreter::Bytecode::kTestEqualStrict:
+    case interpreter::Bytecode::kTestLessThan:
+    case interpreter::Bytecode::kTestGreaterThan:
+    case interpreter::Bytecode::kTestLessThanOrEqual:
+    case interpreter::Bytecode::kTestGreaterThanOrEqual:
+      break;
+    default:
+      return false;
+  }
+  FeedbackSlot slot =
+      it.GetSlotOperand(interpreter::Bytecodes::NumberOfOperands(bytecode) - 1);
+  Handle<FeedbackVector> vector(function->feedback_vector(), isolate());
+  FeedbackNexus nexus(vector, slot);
+
+  switch (nexus.kind()) {
+    case FeedbackSlotKind::kBinaryOp:
+    case FeedbackSlotKind::kCompareOp:
+      return nexus.GeneralizeOperationFeedback();
+    case FeedbackSlotKind::kCall:
+      // Same as what the deoptimizer does for call sites that failed a
+      // speculation on their arguments, see TranslatedState::DoUpdateFeedback.
+      if (nexus.GetSpeculationMode() ==
+          SpeculationMode::kDisallowSpeculation) {
+        return false;
+      }
+      nexus.SetSpeculationMode(SpeculationMode::kDisallowSpeculation);
+      return true;
+    case FeedbackSlotKind::kLoadProperty:
+    case FeedbackSlotKind::kSetNamedSloppy:
+    case FeedbackSlotKind::kSetNamedStrict:
+      return nexus.ConfigureMegamorphic();
+    case FeedbackSlotKind::kLoadKeyed:
+    case FeedbackSlotKind::kSetKeyedSloppy:
+    case FeedbackSlotKind::kSetKeyedStrict:
+      return nexus.ConfigureMegamorphic(nexus.GetKeyType());
+    default:
+      return false;
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
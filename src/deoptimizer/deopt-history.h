@@ -0,0 +1,78 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_DEOPTIMIZER_DEOPT_HISTORY_H_
+#define V8_DEOPTIMIZER_DEOPT_HISTORY_H_
+
+#include <unordered_map>
+#include <vector>
+
+#include "src/base/optional.h"
+#include "src/deoptimizer/deoptimize-reason.h"
+#include "src/handles/handles.h"
+#include "src/utils/utils.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class JSFunction;
+class SharedFunctionInfo;
+
+// Records the eager deopts of each function, per bytecode offset and reason.
+//
+// A deopt loop is the same speculation failing at the same site after every
+// reoptimization, e.g. because the feedback the speculation was based on is
+// never updated by the interpreter. Once a site has deopted
+// --deopt-loop-threshold times for the same reason, the feedback of that site
+// is generalized so that the next optimization doesn't speculate there again,
+// while the rest of the function keeps being optimized as usual.
+class DeoptHistory {
+ public:
+  struct Site {
+    int bytecode_offset;
+    DeoptimizeReason reason;
+    int count;
+    // Whether the feedback at this site was generalized to break a loop.
+    bool speculation_disabled;
+  };
+
+  struct Entry {
+    int deopt_count = 0;
+    std::vector<Site> sites;
+  };
+
+  explicit DeoptHistory(Isolate* isolate) : isolate_(isolate) {}
+
+  // Records an eager deopt of {function} at {bytecode_offset}, and disables
+  // speculation at that site if it turns out to be a deopt loop.
+  void RecordDeopt(Handle<JSFunction> function, BytecodeOffset bytecode_offset,
+                   DeoptimizeReason reason);
+
+  // Returns the deopts recorded for {shared}, or nullptr if there are none.
+  const Entry* Get(Tagged<SharedFunctionInfo> shared) const;
+
+  void Clear() { entries_.clear(); }
+
+ private:
+  // Keep the history bounded; it is dropped wholesale once it grows too big.
+  static constexpr size_t kMaxFunctions = 4096;
+  static constexpr size_t kMaxSitesPerFunction = 16;
+
+  static base::Optional<uint64_t> KeyFor(Tagged<SharedFunctionInfo> shared);
+
+  // Generalizes the feedback used by the bytecode at {bytecode_offset}.
+  // Returns false if that bytecode has no feedback we know how to generalize.
+  bool DisableSpeculationAt(Handle<JSFunction> function, int bytecode_offset);
+
+  Isolate* isolate() const { return isolate_; }
+
+  Isolate* isolate_;
+  std::unordered_map<uint64_t, Entry> entries_;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_DEOPTIMIZER_DEOPT_HISTORY_H_
@@ -42,6 +42,7 @@
 #include "src/date/date.h"
 #include "src/debug/debug-frames.h"
 #include "src/debug/debug.h"
+#include "src/deoptimizer/deopt-history.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/deoptimizer/materialized-object-store.h"
 #include "src/diagnostics/basic-block-profiler.h"
@@ -87,6 +88,7 @@
 #include "src/objects/js-generator-inl.h"
 #include "src/objects/js-struct-inl.h"
 #include "src/objects/js-weak-refs-inl.h"
+#include "src/objects/lookup-cache.h"
 #include "src/objects/managed-inl.h"
 #include "src/objects/module-inl.h"
 #include "src/objects/promise-inl.h"
@@ -4070,6 +4072,9 @@ Isolate::~Isolate() {
   delete descriptor_lookup_cache_;
   descriptor_lookup_cache_ = nullptr;
 
+  delete constant_pool_cache_;
+  constant_pool_cache_ = nullptr;
+
   delete load_stub_cache_;
   load_stub_cache_ = nullptr;
   delete store_stub_cache_;
@@ -4080,6 +4085,9 @@ Isolate::~Isolate() {
   delete materialized_object_store_;
   materialized_object_store_ = nullptr;
 
+  delete deopt_history_;
+  deopt_history_ = nullptr;
+
   delete v8_file_logger_;
   v8_file_logger_ = nullptr;
 
@@ -4639,6 +4647,7 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
 
   compilation_cache_ = new CompilationCache(this);
   descriptor_lookup_cache_ = new DescriptorLookupCache();
+  constant_pool_cache_ = new ConstantPoolCache();
   global_handles_ = new GlobalHandles(this);
   eternal_handles_ = new EternalHandles();
   bootstrapper_ = new Bootstrapper(this);
@@ -4647,6 +4656,7 @@ bool Isolate::Init(SnapshotData* startup_snapshot_data,
   store_stub_cache_ = new StubCache(this);
   define_own_stub_cache_ = new StubCache(this);
   materialized_object_store_ = new MaterializedObjectStore(this);
+  deopt_history_ = new DeoptHistory(this);
   regexp_stack_ = new RegExpStack();
   date_cache_ = new DateCache();
   heap_profiler_ = new HeapProfiler(heap());
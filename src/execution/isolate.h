@@ -119,6 +119,8 @@ class CompilationCache;
 class CompilationStatistics;
 class Counters;
 class Debug;
+class ConstantPoolCache;
+class DeoptHistory;
 class Deoptimizer;
 class DescriptorLookupCache;
 class EmbeddedFileWriterInterface;
@@ -1318,10 +1320,16 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
     return materialized_object_store_;
   }
 
+  DeoptHistory* deopt_history() const { return deopt_history_; }
+
   DescriptorLookupCache* descriptor_lookup_cache() const {
     return descriptor_lookup_cache_;
   }
 
+  ConstantPoolCache* constant_pool_cache() const {
+    return constant_pool_cache_;
+  }
+
   V8_INLINE HandleScopeData* handle_scope_data() {
     return &isolate_data_.handle_scope_data_;
   }
@@ -2375,11 +2383,13 @@ class V8_EXPORT_PRIVATE Isolate final : private HiddenFactory {
   Deoptimizer* current_deoptimizer_ = nullptr;
   bool deoptimizer_lazy_throw_ = false;
   MaterializedObjectStore* materialized_object_store_ = nullptr;
+  DeoptHistory* deopt_history_ = nullptr;
   bool capture_stack_trace_for_uncaught_exceptions_ = false;
   int stack_trace_for_uncaught_exceptions_frame_limit_ = 0;
   StackTrace::StackTraceOptions stack_trace_for_uncaught_exceptions_options_ =
       StackTrace::kOverview;
   DescriptorLookupCache* descriptor_lookup_cache_ = nullptr;
+  ConstantPoolCache* constant_pool_cache_ = nullptr;
   HandleScopeImplementer* handle_scope_implementer_ = nullptr;
   UnicodeCache* unicode_cache_ = nullptr;
   AccountingAllocator* allocator_ = nullptr;
@@ -12,6 +12,7 @@
 #include "src/base/optional.h"
 #include "src/execution/isolate.h"
 #include "src/handles/handles-inl.h"
+#include "src/logging/counters.h"
 #include "src/objects/microtask-inl.h"
 #include "src/objects/visitors.h"
 #include "src/roots/roots-inl.h"
@@ -163,6 +164,11 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
                  !isolate->is_execution_terminating());
 
   intptr_t base_count = finished_microtask_count_;
+  ++checkpoint_count_;
+  max_queue_depth_ = std::max(max_queue_depth_, size());
+  isolate->counters()->microtask_queue_depth()->AddSample(
+      static_cast<int>(std::min<intptr_t>(size(), kMaxInt)));
+  base::TimeTicks start_time = base::TimeTicks::Now();
   HandleScope handle_scope(isolate);
   MaybeHandle<Object> maybe_result;
 
@@ -184,6 +190,7 @@ int MicrotaskQueue::RunMicrotasks(Isolate* isolate) {
       processed_microtask_count =
           static_cast<int>(finished_microtask_count_ - base_count);
     }
+    run_time_ += base::TimeTicks::Now() - start_time;
     TRACE_EVENT_END1("v8.execute", "RunMicrotasks", "microtask_count",
                      processed_microtask_count);
   }
@@ -239,6 +246,15 @@ void MicrotaskQueue::IterateMicrotasks(RootVisitor* visitor) {
   }
 }
 
+v8::MicrotaskQueueStatistics MicrotaskQueue::GetStatistics() const {
+  v8::MicrotaskQueueStatistics statistics;
+  statistics.microtask_count = static_cast<size_t>(finished_microtask_count_);
+  statistics.checkpoint_count = checkpoint_count_;
+  statistics.max_queue_depth = static_cast<size_t>(max_queue_depth_);
+  statistics.run_time_ms = run_time_.InMillisecondsF();
+  return statistics;
+}
+
 void MicrotaskQueue::AddMicrotasksCompletedCallback(
     MicrotasksCompletedCallbackWithData callback, void* data) {
   CallbackWithData callback_with_data(callback, data);
@@ -13,6 +13,7 @@
 #include "include/v8-internal.h"  // For Address.
 #include "include/v8-microtask-queue.h"
 #include "src/base/macros.h"
+#include "src/base/platform/time.h"
 
 namespace v8 {
 namespace internal {
@@ -74,6 +75,7 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   void IncrementMicrotasksScopeDepth() { ++microtasks_depth_; }
   void DecrementMicrotasksScopeDepth() { --microtasks_depth_; }
   int GetMicrotasksScopeDepth() const override { return microtasks_depth_; }
+  v8::MicrotaskQueueStatistics GetStatistics() const override;
 
   // Possibly nested microtasks suppression scopes prevent microtasks
   // from running.
@@ -134,6 +136,12 @@ class V8_EXPORT_PRIVATE MicrotaskQueue final : public v8::MicrotaskQueue {
   // The number of finished microtask.
   intptr_t finished_microtask_count_ = 0;
 
+  // Statistics reported by GetStatistics(). The microtask count is
+  // |finished_microtask_count_|, which is bumped by the RunMicrotasks builtin.
+  size_t checkpoint_count_ = 0;
+  intptr_t max_queue_depth_ = 0;
+  base::TimeDelta run_time_;
+
   // MicrotaskQueue instances form a doubly linked list loop, so that all
   // instances are reachable through |next_|.
   MicrotaskQueue* next_ = nullptr;
@@ -604,6 +604,11 @@ DEFINE_INT(max_maglev_inlined_bytecode_size_small, 27,
            "maximum size of bytecode considered for small function inlining")
 DEFINE_FLOAT(min_maglev_inlining_frequency, 0.10,
              "minimum frequency for inlining")
+DEFINE_BOOL(maglev_polymorphic_inlining, true,
+            "dispatch on the target of polymorphic calls in maglev and "
+            "reduce each target separately")
+DEFINE_INT(max_maglev_polymorphic_call_targets, 4,
+           "maximum number of targets for a polymorphic call in maglev")
 DEFINE_WEAK_VALUE_IMPLICATION(turbofan, max_maglev_inline_depth, 1)
 DEFINE_WEAK_VALUE_IMPLICATION(turbofan, max_maglev_inlined_bytecode_size, 100)
 DEFINE_WEAK_VALUE_IMPLICATION(turbofan,
@@ -849,6 +854,11 @@ DEFINE_BOOL_READONLY(enable_sealed_frozen_elements_kind, true,
 // Flags for data representation optimizations
 DEFINE_BOOL(unbox_double_arrays, true, "automatically unbox arrays of doubles")
 DEFINE_BOOL_READONLY(string_slices, true, "use string slices")
+DEFINE_INT(min_cons_length_to_iterate, 1024,
+           "compare cons strings of at least this length segment by segment "
+           "instead of flattening them")
+DEFINE_BOOL(trace_string_flatten, false,
+            "trace flattening of cons strings and where it happens")
 
 // Tiering: Sparkplug / feedback vector allocation.
 DEFINE_INT(invocation_count_for_feedback_allocation, 8,
@@ -915,6 +925,10 @@ DEFINE_BOOL(stress_ic, false, "exercise interesting paths in ICs more often")
 // Flags for Ignition.
 DEFINE_BOOL(ignition_elide_noneffectful_bytecodes, true,
             "elide bytecodes which won't have any external effect")
+DEFINE_BOOL(ignition_share_constant_pools, true,
+            "share identical constant pools between bytecode arrays")
+DEFINE_BOOL(ignition_jump_threading, false,
+            "retarget forward jumps that land on other jumps in the bytecode")
 DEFINE_BOOL(ignition_reo, true, "use ignition register equivalence optimizer")
 DEFINE_BOOL(ignition_filter_expression_positions, true,
             "filter expression positions before the bytecode pipeline")
@@ -998,6 +1012,9 @@ DEFINE_BOOL_READONLY(concurrent_sparkplug, false,
                      "compile Sparkplug code in a background thread")
 #endif
 DEFINE_STRING(sparkplug_filter, "*", "filter for Sparkplug baseline compiler")
+DEFINE_BOOL(sparkplug_inline_monomorphic_loads, false,
+            "inline the field load of monomorphic named property loads into "
+            "Sparkplug code, based on the feedback at compile time")
 DEFINE_BOOL(sparkplug_needs_short_builtins, false,
             "only enable Sparkplug baseline compiler when "
             "--short-builtin-calls are also enabled")
@@ -1049,6 +1066,13 @@ DEFINE_BOOL(concurrent_recompilation_front_running, true,
 DEFINE_UINT(
     concurrent_turbofan_max_threads, 0,
     "max number of threads that concurrent Turbofan can use (0 for unbounded)")
+DEFINE_INT(concurrent_turbofan_large_bytecode_size, 16 * KB,
+           "bytecode size above which a concurrent Turbofan job is considered "
+           "large (0 to disable)")
+DEFINE_INT(concurrent_turbofan_max_large_jobs, 1,
+           "max number of large concurrent Turbofan jobs compiled at the same "
+           "time; other jobs are picked up by the remaining workers "
+           "(0 for unbounded)")
 DEFINE_BOOL(
     stress_concurrent_inlining, false,
     "create additional concurrent optimization jobs but throw away result")
@@ -1200,6 +1224,9 @@ DEFINE_VALUE_IMPLICATION(stress_inline, max_inlined_bytecode_size_absolute,
 DEFINE_VALUE_IMPLICATION(stress_inline, min_inlining_frequency, 0.)
 DEFINE_IMPLICATION(stress_inline, polymorphic_inlining)
 DEFINE_BOOL(trace_turbo_inlining, false, "trace TurboFan inlining")
+DEFINE_BOOL(turbo_branch_hints_from_feedback, true,
+            "derive branch hints for conditional jumps from whether the "
+            "feedback in their successors has been initialized")
 DEFINE_BOOL(turbo_inline_array_builtins, true,
             "inline array builtins in TurboFan code")
 DEFINE_BOOL(use_osr, true, "use on-stack replacement")
@@ -1324,6 +1351,9 @@ DEFINE_BOOL(turboshaft_wasm_load_elimination, false,
             "enable Turboshaft's WasmLoadElimination")
 DEFINE_WEAK_IMPLICATION(turboshaft_wasm, turboshaft_wasm_load_elimination)
 
+DEFINE_BOOL(turboshaft_defer_cold_exits, true,
+            "mark blocks that inevitably deoptimize or reach unreachable code "
+            "as deferred, so that they are placed out of line")
 DEFINE_BOOL(turboshaft_instruction_selection, true,
             "run instruction selection on Turboshaft IR directly")
 
@@ -2169,6 +2199,12 @@ DEFINE_BOOL(trace_deopt, false, "trace deoptimization")
 DEFINE_BOOL(log_deopt, false, "log deoptimization")
 DEFINE_BOOL(trace_deopt_verbose, false, "extra verbose deoptimization tracing")
 DEFINE_IMPLICATION(trace_deopt_verbose, trace_deopt)
+DEFINE_BOOL(deopt_loop_detection, true,
+            "stop speculating at sites that deoptimize repeatedly")
+DEFINE_INT(deopt_loop_threshold, 3,
+           "number of deopts at the same site and for the same reason after "
+           "which the site is considered to be in a deopt loop")
+DEFINE_BOOL(trace_deopt_loops, false, "trace detected deoptimization loops")
 DEFINE_BOOL(trace_file_names, false,
             "include file names in trace-opt/trace-deopt output")
 DEFINE_BOOL(always_turbofan, false, "always try to optimize functions")
@@ -2287,6 +2323,9 @@ DEFINE_BOOL_READONLY(fast_map_update, false,
                      "enable fast map update by caching the migration target")
 DEFINE_INT(max_valid_polymorphic_map_count, 4,
            "maximum number of valid maps to track in POLYMORPHIC state")
+DEFINE_BOOL(stub_cache_adaptive_sizing, true,
+            "grow the megamorphic stub cache when it is updated more often "
+            "than it has entries between two GCs")
 
 // map-inl.h
 DEFINE_INT(fast_properties_soft_limit, 12,
@@ -2296,6 +2335,19 @@ DEFINE_INT(max_fast_properties, 128,
            "limits the number of mutable properties that can be added to an "
            "object before transitioning to dictionary mode")
 
+// json-parser.cc
+DEFINE_BOOL(json_parse_expected_maps, true,
+            "reuse the maps of objects with the same keys in JSON.parse")
+
+// map-updater.cc
+DEFINE_BOOL(slack_tracking_learn_shapes, false,
+            "when completing in-object slack tracking, reserve in-object "
+            "space in future initial maps of the constructor for properties "
+            "that were added out-of-object")
+DEFINE_BOOL(trace_transition_tree_shapes, false,
+            "trace the shape of the transition tree of initial maps when "
+            "completing in-object slack tracking")
+
 DEFINE_BOOL(native_code_counters, DEBUG_BOOL,
             "generate extra code for manipulating stats counters")
 
@@ -2307,6 +2359,8 @@ DEFINE_BOOL(mega_dom_ic, false, "use MegaDOM IC state for API objects")
 DEFINE_BOOL(trace_prototype_users, false,
             "Trace updates to prototype user tracking")
 DEFINE_BOOL(trace_for_in_enumerate, false, "Trace for-in enumerate slow-paths")
+DEFINE_BOOL(dictionary_enum_keys_cache, true,
+            "cache the enumerable keys of dictionary-mode objects")
 DEFINE_BOOL(log_maps, false, "Log map creation")
 DEFINE_BOOL(log_maps_details, true, "Also log map details")
 DEFINE_IMPLICATION(log_maps, log_code)
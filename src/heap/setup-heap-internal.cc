@@ -1383,6 +1383,7 @@ void Heap::CreateInitialMutableObjects() {
 
   // Initialize descriptor cache.
   isolate_->descriptor_lookup_cache()->Clear();
+  isolate_->constant_pool_cache()->Clear();
 
   // Initialize compilation cache.
   isolate_->compilation_cache()->Clear();
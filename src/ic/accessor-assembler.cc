@@ -2998,7 +2998,8 @@ enum AccessorAssembler::StubCacheTable : int {
   kSecondary = static_cast<int>(StubCache::kSecondary)
 };
 
-TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
+TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(StubCache* stub_cache,
+                                                         TNode<Name> name,
                                                          TNode<Map> map) {
   // Compute the hash of the name (use entire hash field).
   TNode<Uint32T> raw_hash_field = LoadNameRawHash(name);
@@ -3016,10 +3017,10 @@ TNode<IntPtrT> AccessorAssembler::StubCachePrimaryOffset(TNode<Name> name,
       WordXor(map_word, WordShr(map_word, StubCache::kPrimaryTableBits))));
   // Base the offset on a simple combination of name and map.
   TNode<Word32T> hash = Int32Add(raw_hash_field, map32);
-  uint32_t mask = (StubCache::kPrimaryTableSize - 1)
-                  << StubCache::kCacheIndexShift;
-  TNode<UintPtrT> result =
-      ChangeUint32ToWord(Word32And(hash, Int32Constant(mask)));
+  // The primary table can be resized, so its mask has to be loaded.
+  TNode<Uint32T> mask = Load<Uint32T>(ExternalConstant(
+      ExternalReference::Create(stub_cache->primary_mask_reference())));
+  TNode<UintPtrT> result = ChangeUint32ToWord(Word32And(hash, mask));
   return Signed(result);
 }
 
@@ -3052,8 +3053,14 @@ void AccessorAssembler::TryProbeStubCacheTable(
       sizeof(StubCache::Entry) >> StubCache::kCacheIndexShift;
   entry_offset = IntPtrMul(entry_offset, IntPtrConstant(kMultiplier));
 
-  TNode<ExternalReference> key_base = ExternalConstant(
-      ExternalReference::Create(stub_cache->key_reference(table)));
+  // The primary table can be reallocated when it is resized, so its address
+  // has to be loaded.
+  TNode<RawPtrT> key_base =
+      table == StubCache::kPrimary
+          ? Load<RawPtrT>(ExternalConstant(ExternalReference::Create(
+                stub_cache->primary_table_reference())))
+          : ReinterpretCast<RawPtrT>(ExternalConstant(
+                ExternalReference::Create(stub_cache->key_reference(table))));
 
   // Check that the key in the entry matches the name.
   DCHECK_EQ(0, offsetof(StubCache::Entry, key));
@@ -3088,11 +3095,21 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
   Counters* counters = isolate()->counters();
   IncrementCounter(counters->megamorphic_stub_cache_probes(), 1);
 
+  // Only route hits through the counters if they are enabled, to keep the
+  // fast path free of extra jumps otherwise.
+  Label primary_hit(this), secondary_hit(this);
+  Label* if_primary_hit = if_handler;
+  Label* if_secondary_hit = if_handler;
+  if (v8_flags.native_code_counters) {
+    if_primary_hit = &primary_hit;
+    if_secondary_hit = &secondary_hit;
+  }
+
   // Probe the primary table.
   TNode<IntPtrT> primary_offset =
-      StubCachePrimaryOffset(name, lookup_start_object_map);
+      StubCachePrimaryOffset(stub_cache, name, lookup_start_object_map);
   TryProbeStubCacheTable(stub_cache, kPrimary, primary_offset, name,
-                         lookup_start_object_map, if_handler, var_handler,
+                         lookup_start_object_map, if_primary_hit, var_handler,
                          &try_secondary);
 
   BIND(&try_secondary);
@@ -3101,8 +3118,18 @@ void AccessorAssembler::TryProbeStubCache(StubCache* stub_cache,
     TNode<IntPtrT> secondary_offset =
         StubCacheSecondaryOffset(name, lookup_start_object_map);
     TryProbeStubCacheTable(stub_cache, kSecondary, secondary_offset, name,
-                           lookup_start_object_map, if_handler, var_handler,
-                           &miss);
+                           lookup_start_object_map, if_secondary_hit,
+                           var_handler, &miss);
+  }
+
+  if (v8_flags.native_code_counters) {
+    BIND(&primary_hit);
+    IncrementCounter(counters->megamorphic_stub_cache_primary_hits(), 1);
+    Goto(if_handler);
+
+    BIND(&secondary_hit);
+    IncrementCounter(counters->megamorphic_stub_cache_secondary_hits(), 1);
+    Goto(if_handler);
   }
 
   BIND(&miss);
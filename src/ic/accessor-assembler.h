@@ -96,9 +96,10 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
                              if_handler, var_handler, if_miss);
   }
 
-  TNode<IntPtrT> StubCachePrimaryOffsetForTesting(TNode<Name> name,
+  TNode<IntPtrT> StubCachePrimaryOffsetForTesting(StubCache* stub_cache,
+                                                  TNode<Name> name,
                                                   TNode<Map> map) {
-    return StubCachePrimaryOffset(name, map);
+    return StubCachePrimaryOffset(stub_cache, name, map);
   }
   TNode<IntPtrT> StubCacheSecondaryOffsetForTesting(TNode<Name> name,
                                                     TNode<Map> map) {
@@ -587,7 +588,8 @@ class V8_EXPORT_PRIVATE AccessorAssembler : public CodeStubAssembler {
   // including stub cache header.
   enum StubCacheTable : int;
 
-  TNode<IntPtrT> StubCachePrimaryOffset(TNode<Name> name, TNode<Map> map);
+  TNode<IntPtrT> StubCachePrimaryOffset(StubCache* stub_cache,
+                                        TNode<Name> name, TNode<Map> map);
   TNode<IntPtrT> StubCacheSecondaryOffset(TNode<Name> name, TNode<Map> map);
 
   void TryProbeStubCacheTable(StubCache* stub_cache, StubCacheTable table_id,
@@ -14,14 +14,18 @@
 namespace v8 {
 namespace internal {
 
-StubCache::StubCache(Isolate* isolate) : isolate_(isolate) {
+StubCache::StubCache(Isolate* isolate)
+    : primary_(new Entry[kPrimaryTableSize]), isolate_(isolate) {
   // Ensure the nullptr (aka Smi::zero()) which StubCache::Get() returns
   // when the entry is not found is not considered as a handler.
   DCHECK(!IC::IsHandler(Tagged<MaybeObject>()));
 }
 
+StubCache::~StubCache() { delete[] primary_; }
+
 void StubCache::Initialize() {
   DCHECK(base::bits::IsPowerOfTwo(kPrimaryTableSize));
+  DCHECK(base::bits::IsPowerOfTwo(kMaxPrimaryTableSize));
   DCHECK(base::bits::IsPowerOfTwo(kSecondaryTableSize));
   Clear();
 }
@@ -29,7 +33,7 @@ void StubCache::Initialize() {
 // Hash algorithm for the primary table. This algorithm is replicated in
 // the AccessorAssembler.  Returns an index into the table that
 // is scaled by 1 << kCacheIndexShift.
-int StubCache::PrimaryOffset(Tagged<Name> name, Tagged<Map> map) {
+int StubCache::PrimaryOffset(Tagged<Name> name, Tagged<Map> map) const {
   // Compute the hash of the name (use entire hash field).
   uint32_t field = name->RawHash();
   DCHECK(Name::IsHashFieldComputed(field));
@@ -40,7 +44,7 @@ int StubCache::PrimaryOffset(Tagged<Name> name, Tagged<Map> map) {
       static_cast<uint32_t>(map.ptr() ^ (map.ptr() >> kPrimaryTableBits));
   // Base the offset on a simple combination of name and map.
   uint32_t key = map_low32bits + field;
-  return key & ((kPrimaryTableSize - 1) << kCacheIndexShift);
+  return key & primary_mask_;
 }
 
 // Hash algorithm for the secondary table.  This algorithm is replicated in
@@ -109,6 +113,7 @@ void StubCache::Set(Tagged<Name> name, Tagged<Map> map,
   primary->key = StrongTaggedValue(name);
   primary->value = TaggedValue(handler);
   primary->map = StrongTaggedValue(map);
+  updates_since_clear_++;
   isolate()->counters()->megamorphic_stub_cache_updates()->Increment();
 }
 
@@ -127,10 +132,33 @@ Tagged<MaybeObject> StubCache::Get(Tagged<Name> name, Tagged<Map> map) {
   return Tagged<MaybeObject>();
 }
 
+void StubCache::AdaptPrimaryTableSize() {
+  // Every update follows a miss, so more updates than entries means that
+  // entries got evicted before they could be reused. Shrinking is more
+  // conservative, to avoid flip-flopping between two sizes.
+  int size = primary_table_size();
+  int new_size = size;
+  if (updates_since_clear_ > size && size < kMaxPrimaryTableSize) {
+    new_size = size * 2;
+  } else if (updates_since_clear_ < size / 16 && size > kPrimaryTableSize) {
+    new_size = size / 2;
+  }
+  if (new_size == size) return;
+  // The old entries are dropped anyway, since this only happens on Clear().
+  delete[] primary_;
+  primary_ = new Entry[new_size];
+  primary_mask_ = (new_size - 1) << kCacheIndexShift;
+  isolate()->counters()->megamorphic_stub_cache_resizes()->Increment();
+}
+
 void StubCache::Clear() {
+  if (v8_flags.stub_cache_adaptive_sizing) AdaptPrimaryTableSize();
+  updates_since_clear_ = 0;
+
   Tagged<MaybeObject> empty = isolate_->builtins()->code(Builtin::kIllegal);
   Tagged<Name> empty_string = ReadOnlyRoots(isolate()).empty_string();
-  for (int i = 0; i < kPrimaryTableSize; i++) {
+  int primary_table_size = this->primary_table_size();
+  for (int i = 0; i < primary_table_size; i++) {
     primary_[i].key = StrongTaggedValue(empty_string);
     primary_[i].map = StrongTaggedValue(Smi::zero());
     primary_[i].value = TaggedValue(empty);
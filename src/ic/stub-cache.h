@@ -16,6 +16,11 @@ namespace internal {
 // It maps (map, name, type) to property access handlers. The cache does not
 // need explicit invalidation when a prototype chain is modified, since the
 // handlers verify the chain.
+//
+// The primary table grows when it is updated more often than it has entries
+// between two clears (i.e. GCs), and shrinks back when it is mostly idle. It
+// is reallocated on every resize, so generated code loads both its address and
+// its mask from the StubCache instead of embedding them.
 
 class SCTableReference {
  public:
@@ -46,11 +51,18 @@ class V8_EXPORT_PRIVATE StubCache {
   // Access cache for entry hash(name, map).
   void Set(Tagged<Name> name, Tagged<Map> map, Tagged<MaybeObject> handler);
   Tagged<MaybeObject> Get(Tagged<Name> name, Tagged<Map> map);
-  // Clear the lookup table (@ mark compact collection).
+  // Clear the lookup table (@ mark compact collection). Also adapts the size
+  // of the primary table to the number of updates since the last clear.
   void Clear();
 
   enum Table { kPrimary, kSecondary };
 
+  // The key, map and value references of the primary table are only valid
+  // until its next resize; generated code goes through the reference below.
+  SCTableReference primary_table_reference() {
+    return SCTableReference(reinterpret_cast<Address>(&primary_));
+  }
+
   SCTableReference key_reference(StubCache::Table table) {
     return SCTableReference(
         reinterpret_cast<Address>(&first_entry(table)->key));
@@ -66,6 +78,10 @@ class V8_EXPORT_PRIVATE StubCache {
         reinterpret_cast<Address>(&first_entry(table)->value));
   }
 
+  SCTableReference primary_mask_reference() {
+    return SCTableReference(reinterpret_cast<Address>(&primary_mask_));
+  }
+
   StubCache::Entry* first_entry(StubCache::Table table) {
     switch (table) {
       case StubCache::kPrimary:
@@ -85,16 +101,24 @@ class V8_EXPORT_PRIVATE StubCache {
   // the static_assert below, in {entry(...)}).
   static const int kCacheIndexShift = Name::HashBits::kShift;
 
+  // The initial and minimum size of the primary table.
   static const int kPrimaryTableBits = 11;
   static const int kPrimaryTableSize = (1 << kPrimaryTableBits);
+  static const int kMaxPrimaryTableBits = 13;
+  static const int kMaxPrimaryTableSize = (1 << kMaxPrimaryTableBits);
   static const int kSecondaryTableBits = 9;
   static const int kSecondaryTableSize = (1 << kSecondaryTableBits);
 
-  static int PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
+  int primary_table_size() const {
+    return (primary_mask_ >> kCacheIndexShift) + 1;
+  }
+
+  int PrimaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
   static int SecondaryOffsetForTesting(Tagged<Name> name, Tagged<Map> map);
 
   // The constructor is made public only for the purposes of testing.
   explicit StubCache(Isolate* isolate);
+  ~StubCache();
   StubCache(const StubCache&) = delete;
   StubCache& operator=(const StubCache&) = delete;
 
@@ -109,7 +133,10 @@ class V8_EXPORT_PRIVATE StubCache {
   // Hash algorithm for the primary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
   // is scaled by 1 << kCacheIndexShift.
-  static int PrimaryOffset(Tagged<Name> name, Tagged<Map> map);
+  int PrimaryOffset(Tagged<Name> name, Tagged<Map> map) const;
+
+  // Grows or shrinks the primary table, depending on {updates_since_clear_}.
+  void AdaptPrimaryTableSize();
 
   // Hash algorithm for the secondary table.  This algorithm is replicated in
   // assembler for every architecture.  Returns an index into the table that
@@ -131,8 +158,13 @@ class V8_EXPORT_PRIVATE StubCache {
   }
 
  private:
-  Entry primary_[kPrimaryTableSize];
+  // Allocated separately, so that it only takes up as much memory as its
+  // current size needs.
+  Entry* primary_;
   Entry secondary_[kSecondaryTableSize];
+  // The mask for primary table offsets, i.e. (size - 1) << kCacheIndexShift.
+  uint32_t primary_mask_ = (kPrimaryTableSize - 1) << kCacheIndexShift;
+  int updates_since_clear_ = 0;
   Isolate* isolate_;
 
   friend class Isolate;
@@ -4,8 +4,12 @@
 
 #include "src/interpreter/bytecode-array-writer.h"
 
+#include <set>
+
 #include "src/api/api-inl.h"
 #include "src/heap/local-factory-inl.h"
+#include "src/interpreter/bytecode-array-iterator.h"
+#include "src/interpreter/bytecode-decoder.h"
 #include "src/interpreter/bytecode-jump-table.h"
 #include "src/interpreter/bytecode-label.h"
 #include "src/interpreter/bytecode-node.h"
@@ -33,7 +37,10 @@ BytecodeArrayWriter::BytecodeArrayWriter(
       last_bytecode_had_source_info_(false),
       elide_noneffectful_bytecodes_(
           v8_flags.ignition_elide_noneffectful_bytecodes),
-      exit_seen_in_block_(false) {
+      exit_seen_in_block_(false),
+      forward_jumps_(zone),
+      loop_headers_(zone),
+      jumps_threaded_(false) {
   bytecodes_.reserve(512);  // Derived via experimentation.
 }
 
@@ -43,6 +50,8 @@ Handle<BytecodeArray> BytecodeArrayWriter::ToBytecodeArray(
     Handle<TrustedByteArray> handler_table) {
   DCHECK_EQ(0, unbound_jumps_);
 
+  if (!forward_jumps_.empty()) ThreadJumps();
+
   int bytecode_size = static_cast<int>(bytecodes()->size());
   int frame_size = register_count * kSystemPointerSize;
   Handle<TrustedFixedArray> constant_pool =
@@ -50,6 +59,9 @@ Handle<BytecodeArray> BytecodeArrayWriter::ToBytecodeArray(
   Handle<BytecodeArray> bytecode_array = isolate->factory()->NewBytecodeArray(
       bytecode_size, &bytecodes()->front(), frame_size, parameter_count,
       constant_pool, handler_table);
+#ifdef DEBUG
+  if (!forward_jumps_.empty()) VerifyJumpTargets(bytecode_array);
+#endif
   return bytecode_array;
 }
 
@@ -82,6 +94,10 @@ template EXPORT_TEMPLATE_DEFINE(V8_EXPORT_PRIVATE)
 
 #ifdef DEBUG
 int BytecodeArrayWriter::CheckBytecodeMatches(Tagged<BytecodeArray> bytecode) {
+  // {bytecode} was created by ToBytecodeArray, so compare it with the threaded
+  // form of the regenerated bytecode.
+  if (!forward_jumps_.empty()) ThreadJumps();
+
   int mismatches = false;
   int bytecode_size = static_cast<int>(bytecodes()->size());
   const uint8_t* bytecode_ptr = &bytecodes()->front();
@@ -105,6 +121,111 @@ int BytecodeArrayWriter::CheckBytecodeMatches(Tagged<BytecodeArray> bytecode) {
 }
 #endif
 
+namespace {
+
+struct ForwardJump {
+  Bytecode bytecode;
+  OperandScale operand_scale;
+  // Offset of the jump bytecode itself, after any prefix.
+  size_t bytecode_offset;
+  size_t target;
+};
+
+// Decodes the forward jump with an immediate operand at |offset|, if there is
+// one there.
+bool DecodeForwardJumpImmediate(const ZoneVector<uint8_t>& bytecodes,
+                                size_t offset, ForwardJump* jump) {
+  OperandScale operand_scale = OperandScale::kSingle;
+  Bytecode bytecode = Bytecodes::FromByte(bytecodes[offset]);
+  if (Bytecodes::IsPrefixScalingBytecode(bytecode)) {
+    operand_scale = Bytecodes::PrefixBytecodeToOperandScale(bytecode);
+    bytecode = Bytecodes::FromByte(bytecodes[++offset]);
+  }
+  if (!Bytecodes::IsForwardJump(bytecode) ||
+      !Bytecodes::IsJumpImmediate(bytecode)) {
+    return false;
+  }
+  uint32_t delta = BytecodeDecoder::DecodeUnsignedOperand(
+      reinterpret_cast<Address>(&bytecodes[offset + 1]), OperandType::kUImm,
+      operand_scale);
+  *jump = {bytecode, operand_scale, offset, offset + delta};
+  return true;
+}
+
+}  // namespace
+
+void BytecodeArrayWriter::ThreadJumps() {
+  static constexpr int kMaxThreadedJumps = 8;
+  // Threading again could follow chains that were cut off at
+  // kMaxThreadedJumps the first time.
+  if (jumps_threaded_) return;
+  jumps_threaded_ = true;
+  for (const auto& [offset, has_source_info] : forward_jumps_) {
+    ForwardJump jump;
+    if (!DecodeForwardJumpImmediate(bytecodes_, offset, &jump)) continue;
+
+    size_t target = jump.target;
+    for (int i = 0; i < kMaxThreadedJumps; ++i) {
+      // Don't jump past loop headers, which would enter the loop without
+      // going through its header, nor past jumps with source positions, which
+      // the debugger can break on.
+      if (loop_headers_.count(target) != 0) break;
+      auto next_it = forward_jumps_.find(target);
+      if (next_it == forward_jumps_.end() || next_it->second) break;
+      ForwardJump next;
+      if (!DecodeForwardJumpImmediate(bytecodes_, target, &next)) break;
+      // Nothing runs between the two jumps, so the accumulator is the same and
+      // a conditional jump on the same condition is taken as well.
+      bool taken = next.bytecode == Bytecode::kJump ||
+                   (next.bytecode == jump.bytecode &&
+                    Bytecodes::NumberOfOperands(next.bytecode) == 1);
+      if (!taken) break;
+      uint32_t delta =
+          static_cast<uint32_t>(next.target - jump.bytecode_offset);
+      if (Bytecodes::ScaleForUnsignedOperand(delta) > jump.operand_scale) {
+        break;
+      }
+      target = next.target;
+    }
+    if (target == jump.target) continue;
+
+    uint32_t delta = static_cast<uint32_t>(target - jump.bytecode_offset);
+    Address operand = reinterpret_cast<Address>(
+        &bytecodes_[jump.bytecode_offset + 1]);
+    switch (jump.operand_scale) {
+      case OperandScale::kSingle:
+        base::WriteUnalignedValue<uint8_t>(operand,
+                                           static_cast<uint8_t>(delta));
+        break;
+      case OperandScale::kDouble:
+        base::WriteUnalignedValue<uint16_t>(operand,
+                                            static_cast<uint16_t>(delta));
+        break;
+      case OperandScale::kQuadruple:
+        base::WriteUnalignedValue<uint32_t>(operand, delta);
+        break;
+    }
+  }
+}
+
+#ifdef DEBUG
+void BytecodeArrayWriter::VerifyJumpTargets(
+    Handle<BytecodeArray> bytecode_array) {
+  DisallowGarbageCollection no_gc;
+  std::set<int> bytecode_offsets;
+  for (BytecodeArrayIterator it(bytecode_array, 0, no_gc); !it.done();
+       it.Advance()) {
+    bytecode_offsets.insert(it.current_offset());
+  }
+  for (BytecodeArrayIterator it(bytecode_array, 0, no_gc); !it.done();
+       it.Advance()) {
+    if (!Bytecodes::IsForwardJump(it.current_bytecode())) continue;
+    CHECK_GT(it.GetJumpTargetOffset(), it.current_offset());
+    CHECK_EQ(1, bytecode_offsets.count(it.GetJumpTargetOffset()));
+  }
+}
+#endif
+
 void BytecodeArrayWriter::Write(BytecodeNode* node) {
   DCHECK(!Bytecodes::IsJump(node->bytecode()));
 
@@ -468,6 +589,9 @@ void BytecodeArrayWriter::EmitJumpLoop(BytecodeNode* node,
 
   CHECK_GE(current_offset, loop_header->offset());
   CHECK_LE(current_offset, static_cast<size_t>(kMaxUInt32));
+  if (v8_flags.ignition_jump_threading) {
+    loop_headers_.insert(loop_header->offset());
+  }
 
   // Update the actual jump offset now that we know the bytecode offset of both
   // the target loop header and this JumpLoop bytecode.
@@ -502,6 +626,9 @@ void BytecodeArrayWriter::EmitJump(BytecodeNode* node, BytecodeLabel* label) {
   DCHECK_EQ(0u, node->operand(0));
 
   size_t current_offset = bytecodes()->size();
+  if (v8_flags.ignition_jump_threading) {
+    forward_jumps_.emplace(current_offset, node->source_info().is_valid());
+  }
 
   // The label has not yet been bound so this is a forward reference
   // that will be patched when the label is bound. We create a
@@ -8,6 +8,7 @@
 #include "src/codegen/source-position-table.h"
 #include "src/common/globals.h"
 #include "src/interpreter/bytecodes.h"
+#include "src/zone/zone-containers.h"
 
 namespace v8 {
 namespace internal {
@@ -107,6 +108,14 @@ class V8_EXPORT_PRIVATE BytecodeArrayWriter final {
 
   void StartBasicBlock();
 
+  // Retargets forward jumps whose target is another jump that would be taken
+  // right away, so that they jump to the final target directly. Only the first
+  // call has an effect.
+  void ThreadJumps();
+#ifdef DEBUG
+  void VerifyJumpTargets(Handle<BytecodeArray> bytecode_array);
+#endif
+
   ZoneVector<uint8_t>* bytecodes() { return &bytecodes_; }
   SourcePositionTableBuilder* source_position_table_builder() {
     return &source_position_table_builder_;
@@ -127,6 +136,12 @@ class V8_EXPORT_PRIVATE BytecodeArrayWriter final {
 
   bool exit_seen_in_block_;
 
+  // Offsets of the emitted forward jumps, and whether they have source info,
+  // plus the loop header offsets; only recorded for jump threading.
+  ZoneMap<size_t, bool> forward_jumps_;
+  ZoneSet<size_t> loop_headers_;
+  bool jumps_threaded_;
+
   friend class bytecode_array_writer_unittest::BytecodeArrayWriterUnittest;
 };
 
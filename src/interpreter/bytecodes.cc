@@ -283,6 +283,8 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kLdaTheHole:
       case Bytecode::kLdaConstant:
       case Bytecode::kLdaUndefined:
+      case Bytecode::kLdaTrue:
+      case Bytecode::kLdaFalse:
       case Bytecode::kLdaGlobal:
       case Bytecode::kGetNamedProperty:
       case Bytecode::kGetKeyedProperty:
@@ -293,8 +295,14 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kAdd:
       case Bytecode::kSub:
       case Bytecode::kMul:
+      case Bytecode::kDiv:
+      case Bytecode::kMod:
+      case Bytecode::kBitwiseOr:
+      case Bytecode::kBitwiseAnd:
       case Bytecode::kAddSmi:
       case Bytecode::kSubSmi:
+      case Bytecode::kMulSmi:
+      case Bytecode::kBitwiseAndSmi:
       case Bytecode::kInc:
       case Bytecode::kDec:
       case Bytecode::kTypeOf:
@@ -311,6 +319,10 @@ bool Bytecodes::IsStarLookahead(Bytecode bytecode, OperandScale operand_scale) {
       case Bytecode::kConstructWithSpread:
       case Bytecode::kCreateObjectLiteral:
       case Bytecode::kCreateArrayLiteral:
+      case Bytecode::kCreateEmptyObjectLiteral:
+      case Bytecode::kCreateEmptyArrayLiteral:
+      case Bytecode::kCreateClosure:
+      case Bytecode::kCallRuntime:
       case Bytecode::kThrowReferenceErrorIfHole:
       case Bytecode::kGetTemplateObject:
         return true;
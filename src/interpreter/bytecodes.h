@@ -990,7 +990,8 @@ class V8_EXPORT_PRIVATE Bytecodes final : public AllStatic {
   static bool IsRegisterListOperandType(OperandType operand_type);
 
   // Returns true if the handler for |bytecode| should look ahead and inline a
-  // dispatch to a Star bytecode.
+  // dispatch to a Star bytecode. Candidates for this list can be found from
+  // dispatch counters with tools/ignition/bytecode_dispatches_report.py.
   static bool IsStarLookahead(Bytecode bytecode, OperandScale operand_scale);
 
   // Returns the number of registers represented by a register operand. For
@@ -7,6 +7,7 @@
 #include <cmath>
 #include <functional>
 #include <set>
+#include <type_traits>
 
 #include "src/ast/ast-value-factory.h"
 #include "src/ast/scopes.h"
@@ -15,6 +16,8 @@
 #include "src/handles/handles.h"
 #include "src/heap/local-factory-inl.h"
 #include "src/interpreter/bytecode-operands.h"
+#include "src/logging/counters.h"
+#include "src/objects/lookup-cache.h"
 #include "src/objects/objects-inl.h"
 
 namespace v8 {
@@ -215,6 +218,18 @@ Handle<TrustedFixedArray> ConstantArrayBuilder::ToFixedArray(
     array_index += padding;
   }
   DCHECK_GE(array_index, fixed_array->length());
+  if constexpr (std::is_same_v<IsolateT, Isolate>) {
+    // Functions that only refer to the same names and Smis can use the same
+    // constant pool, which adds up for many small, rarely run functions.
+    if (v8_flags.ignition_share_constant_pools) {
+      Tagged<TrustedFixedArray> shared =
+          isolate->constant_pool_cache()->Canonicalize(*fixed_array);
+      if (shared != *fixed_array) {
+        isolate->counters()->shared_constant_pools()->Increment();
+        return handle(shared, isolate);
+      }
+    }
+  }
   return fixed_array;
 }
 
@@ -12,6 +12,7 @@
 #include "src/debug/debug.h"
 #include "src/execution/frames-inl.h"
 #include "src/heap/factory.h"
+#include "src/json/json-simd.h"
 #include "src/numbers/conversions.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/elements-kind.h"
@@ -23,6 +24,7 @@
 #include "src/objects/property-details.h"
 #include "src/roots/roots.h"
 #include "src/strings/char-predicates-inl.h"
+#include "src/strings/string-hasher-inl.h"
 #include "src/strings/string-hasher.h"
 #include "src/utils/boxed-float.h"
 
@@ -580,6 +582,14 @@ template <typename Char>
 void JsonParser<Char>::SkipWhitespace() {
   JsonToken local_next = JsonToken::EOS;
 
+  // Most tokens are followed by at most one whitespace character; only use
+  // the vectorized scan for longer runs, e.g. indentation.
+  if (cursor_ + 1 < end_ && GetTokenForCharacter(*cursor_) ==
+                                JsonToken::WHITESPACE &&
+      GetTokenForCharacter(cursor_[1]) == JsonToken::WHITESPACE) {
+    cursor_ = SkipJsonWhitespace(cursor_ + 2, end_);
+  }
+
   cursor_ = std::find_if(cursor_, end_, [&](Char c) {
     JsonToken current = GetTokenForCharacter(c);
     bool result = current != JsonToken::WHITESPACE;
@@ -1344,6 +1354,56 @@ Handle<Object> JsonParser<Char>::BuildJsonObject(
   return js_data_object_builder.BuildFromIterator(it, elements);
 }
 
+template <typename Char>
+uint32_t JsonParser<Char>::ComputeNamedKeysHash(
+    const JsonContinuation& cont,
+    const SmallVector<JsonProperty>& property_stack) {
+  DisallowGarbageCollection no_gc;
+  uint32_t hash = 0;
+  for (size_t i = cont.index; i < property_stack.size(); i++) {
+    const JsonString& key = property_stack[i].string;
+    if (key.is_index()) continue;
+    // Hash the raw characters; keys spelled with different escapes merely
+    // miss the cache.
+    const Char* chars = chars_ + key.start();
+    for (int j = 0; j < key.length(); j++) {
+      hash = StringHasher::AddCharacterCore(hash, chars[j]);
+    }
+    hash = StringHasher::AddCharacterCore(hash, '"');
+  }
+  return StringHasher::GetHashCore(hash);
+}
+
+template <typename Char>
+Handle<Map> JsonParser<Char>::LookupExpectedMap(uint32_t keys_hash) {
+  int index = (keys_hash % kExpectedMapsCacheSize) * 2;
+  Tagged<Object> maybe_map = expected_maps_->get(index + 1);
+  if (!IsMap(maybe_map) ||
+      Smi::ToInt(expected_maps_->get(index)) !=
+          static_cast<int>(keys_hash >> 2)) {
+    return Handle<Map>();
+  }
+  // The map is only a hint: JSDataObjectBuilder checks the keys against its
+  // descriptors and falls back to transitions on a mismatch.
+  Handle<Map> map(Map::cast(maybe_map), isolate_);
+  if (map->IsDetached(isolate_)) return Handle<Map>();
+  if (map->is_deprecated()) return Map::Update(isolate_, map);
+  return map;
+}
+
+template <typename Char>
+void JsonParser<Char>::RecordExpectedMap(uint32_t keys_hash,
+                                         Handle<Object> object) {
+  DisallowGarbageCollection no_gc;
+  if (!IsJSObject(*object)) return;
+  Tagged<Map> map = JSObject::cast(*object)->map();
+  if (map->is_dictionary_map()) return;
+  int index = (keys_hash % kExpectedMapsCacheSize) * 2;
+  Tagged<FixedArray> cache = *expected_maps_;
+  cache->set(index, Smi::FromInt(static_cast<int>(keys_hash >> 2)));
+  cache->set(index + 1, map);
+}
+
 template <typename Char>
 Handle<Object> JsonParser<Char>::BuildJsonArray(
     const JsonContinuation& cont,
@@ -1439,6 +1499,13 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue(Handle<Object> reviver) {
 
   cont_stack.reserve(16);
 
+  if (v8_flags.json_parse_expected_maps) {
+    SkipWhitespace();
+    if (peek() == JsonToken::LBRACE || peek() == JsonToken::LBRACK) {
+      expected_maps_ = factory()->NewFixedArray(kExpectedMapsCacheSize * 2);
+    }
+  }
+
   JsonContinuation cont(isolate_, JsonContinuation::kReturn, 0);
 
   Handle<Object> value;
@@ -1655,8 +1722,15 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue(Handle<Object> reviver) {
             break;
           }
 
+          // Prefer the map of an earlier object with the same keys over the
+          // map of the previous array element.
+          uint32_t keys_hash = 0;
           Handle<Map> feedback;
-          if (cont_stack.size() > 0 &&
+          if (!expected_maps_.is_null()) {
+            keys_hash = ComputeNamedKeysHash(cont, property_stack);
+            feedback = LookupExpectedMap(keys_hash);
+          }
+          if (feedback.is_null() && cont_stack.size() > 0 &&
               cont_stack.back().type() == JsonContinuation::kArrayElement &&
               cont_stack.back().index < element_stack.size() &&
               IsJSObject(*element_stack.back())) {
@@ -1672,6 +1746,7 @@ MaybeHandle<Object> JsonParser<Char>::ParseJsonValue(Handle<Object> reviver) {
             }
           }
           value = BuildJsonObject(cont, property_stack, feedback);
+          if (!expected_maps_.is_null()) RecordExpectedMap(keys_hash, value);
           Expect(JsonToken::RBRACE,
                  MessageTemplate::kJsonParseExpectedCommaOrRBrace);
           // Return the object.
@@ -2004,13 +2079,13 @@ JsonString JsonParser<Char>::ScanJsonString(bool needs_internalization) {
   base::uc32 bits = 0;
 
   while (true) {
-    cursor_ = std::find_if(cursor_, end_, [&bits](Char c) {
-      if (sizeof(Char) == 2 && V8_UNLIKELY(c > unibrow::Latin1::kMaxChar)) {
-        bits |= c;
-        return false;
-      }
-      return MayTerminateJsonString(character_json_scan_flags[c]);
-    });
+    if constexpr (sizeof(Char) == 1) {
+      cursor_ = FindJsonStringTerminator(cursor_, end_);
+    } else {
+      cursor_ = FindJsonStringTerminator(cursor_, end_, &bits);
+    }
+    DCHECK_IMPLIES(!is_at_end(),
+                   MayTerminateJsonString(character_json_scan_flags[*cursor_]));
 
     if (V8_UNLIKELY(is_at_end())) {
       AllowGarbageCollection allow_before_exception;
@@ -326,6 +326,14 @@ class JsonParser final {
   Handle<Object> BuildJsonObject(
       const JsonContinuation& cont,
       const SmallVector<JsonProperty>& property_stack, Handle<Map> feedback);
+
+  // Maps of previously built objects, indexed by a hash of their named keys,
+  // are used as the expected final map for later objects with the same keys.
+  uint32_t ComputeNamedKeysHash(
+      const JsonContinuation& cont,
+      const SmallVector<JsonProperty>& property_stack);
+  Handle<Map> LookupExpectedMap(uint32_t keys_hash);
+  void RecordExpectedMap(uint32_t keys_hash, Handle<Object> object);
   Handle<Object> BuildJsonArray(
       const JsonContinuation& cont,
       const SmallVector<Handle<Object>>& element_stack);
@@ -395,6 +403,10 @@ class JsonParser final {
   // The parsed value's source to be passed to the reviver, if the reviver is
   // callable.
   MaybeHandle<Object> parsed_val_node_;
+  // Cache of (keys hash, map) pairs for objects built during this parse. Only
+  // allocated if the JSON value is an object or array.
+  static const int kExpectedMapsCacheSize = 32;
+  Handle<FixedArray> expected_maps_;
 
   // Cached pointer to the raw chars in source. In case source is on-heap, we
   // register an UpdatePointers callback. For this reason, chars_, cursor_ and
@@ -0,0 +1,409 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json/json-simd.h"
+
+#include "src/base/bits.h"
+#include "src/codegen/cpu-features.h"
+#include "src/strings/unicode.h"
+
+#ifdef _MSC_VER
+// MSVC doesn't define SSE3. However, it does define AVX, and AVX implies SSE3.
+#ifdef __AVX__
+#ifndef __SSE3__
+#define __SSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// As in src/objects/simd.cc, Neon is only used on 64-bit ARM.
+#define NEON64
+#include <arm_neon.h>
+#endif
+
+// The AVX2 code is generated without -mavx2 and only called if the CPU
+// supports it, see src/objects/simd.cc.
+#if defined(__SSE3__) && !defined(_M_IX86) &&           \
+    !(defined(_MSC_VER) && defined(__clang__)) &&       \
+    (defined(V8_TARGET_ARCH_IA32) || defined(V8_TARGET_ARCH_X64))
+#define JSON_SIMD_AVX2
+#ifdef _MSC_VER
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Must match MayTerminateJsonString in json-parser.cc.
+template <typename Char>
+constexpr bool IsJsonStringTerminator(Char c) {
+  return c < 0x20 || c == '"' || c == '\\';
+}
+
+constexpr bool IsJsonEscapeCharacter(uint16_t c) {
+  return IsJsonStringTerminator(c) || (c & 0xF800) == 0xD800;
+}
+
+template <typename Char>
+constexpr bool IsJsonWhitespace(Char c) {
+  return c == ' ' || c == '\t' || c == '\n' || c == '\r';
+}
+
+const uint8_t* FindJsonStringTerminatorScalar(const uint8_t* start,
+                                              const uint8_t* end) {
+  for (; start < end; ++start) {
+    if (IsJsonStringTerminator(*start)) break;
+  }
+  return start;
+}
+
+const uint16_t* FindJsonStringTerminatorScalar(const uint16_t* start,
+                                               const uint16_t* end,
+                                               base::uc32* bits) {
+  for (; start < end; ++start) {
+    uint16_t c = *start;
+    if (c > unibrow::Latin1::kMaxChar) {
+      *bits |= c;
+      continue;
+    }
+    if (IsJsonStringTerminator(c)) break;
+  }
+  return start;
+}
+
+const uint16_t* FindJsonEscapeCharacterScalar(const uint16_t* start,
+                                              const uint16_t* end) {
+  for (; start < end; ++start) {
+    if (IsJsonEscapeCharacter(*start)) break;
+  }
+  return start;
+}
+
+template <typename Char>
+const Char* SkipJsonWhitespaceScalar(const Char* start, const Char* end) {
+  for (; start < end; ++start) {
+    if (!IsJsonWhitespace(*start)) break;
+  }
+  return start;
+}
+
+#ifdef __SSE3__
+// Only SSE2 instructions are used below.
+
+const uint8_t* FindJsonStringTerminatorSSE(const uint8_t* start,
+                                           const uint8_t* end) {
+  const __m128i quote = _mm_set1_epi8('"');
+  const __m128i backslash = _mm_set1_epi8('\\');
+  const __m128i max_control = _mm_set1_epi8(0x1F);
+  const __m128i zero = _mm_setzero_si128();
+  for (; end - start >= 16; start += 16) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+    // Unsigned chars <= 0x1F saturate to zero.
+    __m128i matches = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(chars, quote),
+                     _mm_cmpeq_epi8(chars, backslash)),
+        _mm_cmpeq_epi8(_mm_subs_epu8(chars, max_control), zero));
+    uint32_t mask = _mm_movemask_epi8(matches);
+    if (mask != 0) return start + base::bits::CountTrailingZeros32(mask);
+  }
+  return FindJsonStringTerminatorScalar(start, end);
+}
+
+const uint16_t* FindJsonStringTerminatorSSE(const uint16_t* start,
+                                            const uint16_t* end,
+                                            base::uc32* bits) {
+  const __m128i quote = _mm_set1_epi16('"');
+  const __m128i backslash = _mm_set1_epi16('\\');
+  const __m128i max_control = _mm_set1_epi16(0x1F);
+  const __m128i high_byte = _mm_set1_epi16(static_cast<int16_t>(0xFF00));
+  const __m128i zero = _mm_setzero_si128();
+  __m128i non_one_byte = zero;
+  for (; end - start >= 8; start += 8) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+    __m128i matches = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(chars, quote),
+                     _mm_cmpeq_epi16(chars, backslash)),
+        _mm_cmpeq_epi16(_mm_subs_epu16(chars, max_control), zero));
+    // The scalar loop finds the terminator in this block and collects the
+    // bits of the characters in front of it.
+    if (_mm_movemask_epi8(matches) != 0) break;
+    non_one_byte = _mm_or_si128(non_one_byte, _mm_and_si128(chars, high_byte));
+  }
+  if (_mm_movemask_epi8(_mm_cmpeq_epi16(non_one_byte, zero)) != 0xFFFF) {
+    *bits |= unibrow::Latin1::kMaxChar + 1;
+  }
+  return FindJsonStringTerminatorScalar(start, end, bits);
+}
+
+const uint16_t* FindJsonEscapeCharacterSSE(const uint16_t* start,
+                                            const uint16_t* end) {
+  const __m128i quote = _mm_set1_epi16('"');
+  const __m128i backslash = _mm_set1_epi16('\\');
+  const __m128i max_control = _mm_set1_epi16(0x1F);
+  const __m128i surrogate_mask = _mm_set1_epi16(static_cast<int16_t>(0xF800));
+  const __m128i surrogate = _mm_set1_epi16(static_cast<int16_t>(0xD800));
+  const __m128i zero = _mm_setzero_si128();
+  for (; end - start >= 8; start += 8) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+    __m128i matches = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(chars, quote),
+                     _mm_cmpeq_epi16(chars, backslash)),
+        _mm_or_si128(
+            _mm_cmpeq_epi16(_mm_subs_epu16(chars, max_control), zero),
+            _mm_cmpeq_epi16(_mm_and_si128(chars, surrogate_mask), surrogate)));
+    // Two mask bits per character.
+    uint32_t mask = _mm_movemask_epi8(matches);
+    if (mask != 0) return start + base::bits::CountTrailingZeros32(mask) / 2;
+  }
+  return FindJsonEscapeCharacterScalar(start, end);
+}
+
+const uint8_t* SkipJsonWhitespaceSSE(const uint8_t* start,
+                                     const uint8_t* end) {
+  const __m128i space = _mm_set1_epi8(' ');
+  const __m128i tab = _mm_set1_epi8('\t');
+  const __m128i new_line = _mm_set1_epi8('\n');
+  const __m128i carriage_return = _mm_set1_epi8('\r');
+  for (; end - start >= 16; start += 16) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+    __m128i whitespace = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi8(chars, space), _mm_cmpeq_epi8(chars, tab)),
+        _mm_or_si128(_mm_cmpeq_epi8(chars, new_line),
+                     _mm_cmpeq_epi8(chars, carriage_return)));
+    uint32_t mask = ~_mm_movemask_epi8(whitespace) & 0xFFFF;
+    if (mask != 0) return start + base::bits::CountTrailingZeros32(mask);
+  }
+  return SkipJsonWhitespaceScalar(start, end);
+}
+
+const uint16_t* SkipJsonWhitespaceSSE(const uint16_t* start,
+                                      const uint16_t* end) {
+  const __m128i space = _mm_set1_epi16(' ');
+  const __m128i tab = _mm_set1_epi16('\t');
+  const __m128i new_line = _mm_set1_epi16('\n');
+  const __m128i carriage_return = _mm_set1_epi16('\r');
+  for (; end - start >= 8; start += 8) {
+    __m128i chars = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+    __m128i whitespace = _mm_or_si128(
+        _mm_or_si128(_mm_cmpeq_epi16(chars, space),
+                     _mm_cmpeq_epi16(chars, tab)),
+        _mm_or_si128(_mm_cmpeq_epi16(chars, new_line),
+                     _mm_cmpeq_epi16(chars, carriage_return)));
+    // Two mask bits per character.
+    uint32_t mask = ~_mm_movemask_epi8(whitespace) & 0xFFFF;
+    if (mask != 0) return start + base::bits::CountTrailingZeros32(mask) / 2;
+  }
+  return SkipJsonWhitespaceScalar(start, end);
+}
+#endif  // __SSE3__
+
+#ifdef JSON_SIMD_AVX2
+TARGET_AVX2 const uint8_t* FindJsonStringTerminatorAVX2(const uint8_t* start,
+                                                        const uint8_t* end) {
+  const __m256i quote = _mm256_set1_epi8('"');
+  const __m256i backslash = _mm256_set1_epi8('\\');
+  const __m256i max_control = _mm256_set1_epi8(0x1F);
+  const __m256i zero = _mm256_setzero_si256();
+  for (; end - start >= 32; start += 32) {
+    __m256i chars =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(start));
+    __m256i matches = _mm256_or_si256(
+        _mm256_or_si256(_mm256_cmpeq_epi8(chars, quote),
+                        _mm256_cmpeq_epi8(chars, backslash)),
+        _mm256_cmpeq_epi8(_mm256_subs_epu8(chars, max_control), zero));
+    uint32_t mask = _mm256_movemask_epi8(matches);
+    if (mask != 0) return start + base::bits::CountTrailingZeros32(mask);
+  }
+  return FindJsonStringTerminatorSSE(start, end);
+}
+#endif  // JSON_SIMD_AVX2
+
+#ifdef NEON64
+// Returns a mask with 4 bits per byte of {matches}.
+inline uint64_t NeonByteMask(uint8x16_t matches) {
+  return vget_lane_u64(
+      vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+}
+
+// Returns a mask with 8 bits per lane of {matches}.
+inline uint64_t NeonHalfwordMask(uint16x8_t matches) {
+  return vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(matches)), 0);
+}
+
+const uint8_t* FindJsonStringTerminatorNeon(const uint8_t* start,
+                                            const uint8_t* end) {
+  const uint8x16_t quote = vdupq_n_u8('"');
+  const uint8x16_t backslash = vdupq_n_u8('\\');
+  const uint8x16_t max_control = vdupq_n_u8(0x1F);
+  for (; end - start >= 16; start += 16) {
+    uint8x16_t chars = vld1q_u8(start);
+    uint8x16_t matches =
+        vorrq_u8(vorrq_u8(vceqq_u8(chars, quote), vceqq_u8(chars, backslash)),
+                 vcleq_u8(chars, max_control));
+    uint64_t mask = NeonByteMask(matches);
+    if (mask != 0) return start + base::bits::CountTrailingZeros64(mask) / 4;
+  }
+  return FindJsonStringTerminatorScalar(start, end);
+}
+
+const uint16_t* FindJsonStringTerminatorNeon(const uint16_t* start,
+                                             const uint16_t* end,
+                                             base::uc32* bits) {
+  const uint16x8_t quote = vdupq_n_u16('"');
+  const uint16x8_t backslash = vdupq_n_u16('\\');
+  const uint16x8_t max_control = vdupq_n_u16(0x1F);
+  const uint16x8_t high_byte = vdupq_n_u16(0xFF00);
+  uint16x8_t non_one_byte = vdupq_n_u16(0);
+  for (; end - start >= 8; start += 8) {
+    uint16x8_t chars = vld1q_u16(start);
+    uint16x8_t matches = vorrq_u16(
+        vorrq_u16(vceqq_u16(chars, quote), vceqq_u16(chars, backslash)),
+        vcleq_u16(chars, max_control));
+    // The scalar loop finds the terminator in this block and collects the
+    // bits of the characters in front of it.
+    if (NeonHalfwordMask(matches) != 0) break;
+    non_one_byte = vorrq_u16(non_one_byte, vandq_u16(chars, high_byte));
+  }
+  if (vmaxvq_u16(non_one_byte) != 0) {
+    *bits |= unibrow::Latin1::kMaxChar + 1;
+  }
+  return FindJsonStringTerminatorScalar(start, end, bits);
+}
+
+const uint16_t* FindJsonEscapeCharacterNeon(const uint16_t* start,
+                                             const uint16_t* end) {
+  const uint16x8_t quote = vdupq_n_u16('"');
+  const uint16x8_t backslash = vdupq_n_u16('\\');
+  const uint16x8_t max_control = vdupq_n_u16(0x1F);
+  const uint16x8_t surrogate_mask = vdupq_n_u16(0xF800);
+  const uint16x8_t surrogate = vdupq_n_u16(0xD800);
+  for (; end - start >= 8; start += 8) {
+    uint16x8_t chars = vld1q_u16(start);
+    uint16x8_t matches = vorrq_u16(
+        vorrq_u16(vceqq_u16(chars, quote), vceqq_u16(chars, backslash)),
+        vorrq_u16(vcleq_u16(chars, max_control),
+                  vceqq_u16(vandq_u16(chars, surrogate_mask), surrogate)));
+    uint64_t mask = NeonHalfwordMask(matches);
+    if (mask != 0) return start + base::bits::CountTrailingZeros64(mask) / 8;
+  }
+  return FindJsonEscapeCharacterScalar(start, end);
+}
+
+const uint8_t* SkipJsonWhitespaceNeon(const uint8_t* start,
+                                      const uint8_t* end) {
+  const uint8x16_t space = vdupq_n_u8(' ');
+  const uint8x16_t tab = vdupq_n_u8('\t');
+  const uint8x16_t new_line = vdupq_n_u8('\n');
+  const uint8x16_t carriage_return = vdupq_n_u8('\r');
+  for (; end - start >= 16; start += 16) {
+    uint8x16_t chars = vld1q_u8(start);
+    uint8x16_t whitespace =
+        vorrq_u8(vorrq_u8(vceqq_u8(chars, space), vceqq_u8(chars, tab)),
+                 vorrq_u8(vceqq_u8(chars, new_line),
+                          vceqq_u8(chars, carriage_return)));
+    uint64_t mask = NeonByteMask(vmvnq_u8(whitespace));
+    if (mask != 0) return start + base::bits::CountTrailingZeros64(mask) / 4;
+  }
+  return SkipJsonWhitespaceScalar(start, end);
+}
+
+const uint16_t* SkipJsonWhitespaceNeon(const uint16_t* start,
+                                       const uint16_t* end) {
+  const uint16x8_t space = vdupq_n_u16(' ');
+  const uint16x8_t tab = vdupq_n_u16('\t');
+  const uint16x8_t new_line = vdupq_n_u16('\n');
+  const uint16x8_t carriage_return = vdupq_n_u16('\r');
+  for (; end - start >= 8; start += 8) {
+    uint16x8_t chars = vld1q_u16(start);
+    uint16x8_t whitespace =
+        vorrq_u16(vorrq_u16(vceqq_u16(chars, space), vceqq_u16(chars, tab)),
+                  vorrq_u16(vceqq_u16(chars, new_line),
+                            vceqq_u16(chars, carriage_return)));
+    uint64_t mask = NeonHalfwordMask(vmvnq_u16(whitespace));
+    if (mask != 0) return start + base::bits::CountTrailingZeros64(mask) / 8;
+  }
+  return SkipJsonWhitespaceScalar(start, end);
+}
+#endif  // NEON64
+
+}  // namespace
+
+const uint8_t* FindJsonStringTerminator(const uint8_t* start,
+                                        const uint8_t* end) {
+#ifdef JSON_SIMD_AVX2
+  if (CpuFeatures::IsSupported(AVX2)) {
+    return FindJsonStringTerminatorAVX2(start, end);
+  }
+#endif
+#if defined(__SSE3__)
+  return FindJsonStringTerminatorSSE(start, end);
+#elif defined(NEON64)
+  return FindJsonStringTerminatorNeon(start, end);
+#else
+  return FindJsonStringTerminatorScalar(start, end);
+#endif
+}
+
+const uint16_t* FindJsonStringTerminator(const uint16_t* start,
+                                         const uint16_t* end,
+                                         base::uc32* bits) {
+#if defined(__SSE3__)
+  return FindJsonStringTerminatorSSE(start, end, bits);
+#elif defined(NEON64)
+  return FindJsonStringTerminatorNeon(start, end, bits);
+#else
+  return FindJsonStringTerminatorScalar(start, end, bits);
+#endif
+}
+
+const uint16_t* FindJsonEscapeCharacter(const uint16_t* start,
+                                        const uint16_t* end) {
+#if defined(__SSE3__)
+  return FindJsonEscapeCharacterSSE(start, end);
+#elif defined(NEON64)
+  return FindJsonEscapeCharacterNeon(start, end);
+#else
+  return FindJsonEscapeCharacterScalar(start, end);
+#endif
+}
+
+const uint8_t* SkipJsonWhitespace(const uint8_t* start, const uint8_t* end) {
+#if defined(__SSE3__)
+  return SkipJsonWhitespaceSSE(start, end);
+#elif defined(NEON64)
+  return SkipJsonWhitespaceNeon(start, end);
+#else
+  return SkipJsonWhitespaceScalar(start, end);
+#endif
+}
+
+const uint16_t* SkipJsonWhitespace(const uint16_t* start,
+                                   const uint16_t* end) {
+#if defined(__SSE3__)
+  return SkipJsonWhitespaceSSE(start, end);
+#elif defined(NEON64)
+  return SkipJsonWhitespaceNeon(start, end);
+#else
+  return SkipJsonWhitespaceScalar(start, end);
+#endif
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#undef JSON_SIMD_AVX2
+#undef TARGET_AVX2
+#ifdef NEON64
+#undef NEON64
+#endif
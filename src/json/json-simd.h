@@ -0,0 +1,47 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_SIMD_H_
+#define V8_JSON_JSON_SIMD_H_
+
+#include <cstdint>
+
+#include "src/base/strings.h"
+
+namespace v8 {
+namespace internal {
+
+// Vectorized scanning of JSON text, with a scalar fallback for platforms
+// without SIMD support and for the tail of the input.
+
+// Returns the first character in [start, end) that may terminate a JSON
+// string, i.e. '"', '\\' or a control character, or {end} if there is none.
+const uint8_t* FindJsonStringTerminator(const uint8_t* start,
+                                        const uint8_t* end);
+// As above. The skipped characters that don't fit in one byte are or'ed
+// into {bits}, or at least a bit above the one-byte range is set.
+const uint16_t* FindJsonStringTerminator(const uint16_t* start,
+                                         const uint16_t* end,
+                                         base::uc32* bits);
+
+// Returns the first character in [start, end) that JSON.stringify may have to
+// escape, i.e. '"', '\\', a control character or a surrogate, or {end} if
+// there is none.
+inline const uint8_t* FindJsonEscapeCharacter(const uint8_t* start,
+                                              const uint8_t* end) {
+  return FindJsonStringTerminator(start, end);
+}
+const uint16_t* FindJsonEscapeCharacter(const uint16_t* start,
+                                        const uint16_t* end);
+
+// Returns the first character in [start, end) that is not JSON whitespace,
+// or {end} if there is none.
+const uint8_t* SkipJsonWhitespace(const uint8_t* start, const uint8_t* end);
+const uint16_t* SkipJsonWhitespace(const uint16_t* start,
+                                   const uint16_t* end);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_SIMD_H_
@@ -0,0 +1,147 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json/json-streaming-parser.h"
+
+#include "include/v8-primitive.h"
+#include "src/execution/isolate.h"
+#include "src/heap/factory.h"
+#include "src/json/json-parser.h"
+#include "src/objects/string-inl.h"
+#include "src/strings/unicode-inl.h"
+
+namespace v8 {
+namespace internal {
+
+// The resources own the accumulated characters once they are handed to an
+// external string, and are disposed of by the GC together with it.
+class JsonStreamingParser::OneByteResource final
+    : public v8::String::ExternalOneByteStringResource {
+ public:
+  explicit OneByteResource(std::vector<uint8_t> chars)
+      : chars_(std::move(chars)) {}
+
+  const char* data() const override {
+    return reinterpret_cast<const char*>(chars_.data());
+  }
+  size_t length() const override { return chars_.size(); }
+
+ private:
+  const std::vector<uint8_t> chars_;
+};
+
+class JsonStreamingParser::TwoByteResource final
+    : public v8::String::ExternalStringResource {
+ public:
+  explicit TwoByteResource(std::vector<base::uc16> chars)
+      : chars_(std::move(chars)) {}
+
+  const uint16_t* data() const override { return chars_.data(); }
+  size_t length() const override { return chars_.size(); }
+
+ private:
+  const std::vector<base::uc16> chars_;
+};
+
+JsonStreamingParser::JsonStreamingParser(Isolate* isolate, Encoding encoding)
+    : isolate_(isolate), encoding_(encoding) {}
+
+void JsonStreamingParser::Append(const uint8_t* data, size_t length) {
+  DCHECK(!finished_);
+  if (encoding_ == Encoding::kUtf8) return AppendUtf8(data, length);
+  if (is_one_byte_) {
+    one_byte_chars_.insert(one_byte_chars_.end(), data, data + length);
+  } else {
+    two_byte_chars_.insert(two_byte_chars_.end(), data, data + length);
+  }
+}
+
+void JsonStreamingParser::AppendUtf8(const uint8_t* data, size_t length) {
+  const uint8_t* cursor = data;
+  const uint8_t* end = data + length;
+  while (cursor < end) {
+    // Copy runs of ASCII characters in bulk.
+    if (utf8_state_ == unibrow::Utf8::State::kAccept &&
+        *cursor <= unibrow::Utf8::kMaxOneByteChar) {
+      const uint8_t* run_end = cursor + 1;
+      while (run_end < end && *run_end <= unibrow::Utf8::kMaxOneByteChar) {
+        run_end++;
+      }
+      if (is_one_byte_) {
+        one_byte_chars_.insert(one_byte_chars_.end(), cursor, run_end);
+      } else {
+        two_byte_chars_.insert(two_byte_chars_.end(), cursor, run_end);
+      }
+      cursor = run_end;
+      continue;
+    }
+    // A character may be split across chunks, in which case the decoder
+    // state carries over to the next chunk.
+    unibrow::uchar c = unibrow::Utf8::ValueOfIncremental(
+        &cursor, &utf8_state_, &utf8_incomplete_char_);
+    if (c != unibrow::Utf8::kIncomplete) AppendCharacter(c);
+  }
+}
+
+void JsonStreamingParser::AppendCharacter(unibrow::uchar c) {
+  if (is_one_byte_) {
+    if (c <= unibrow::Latin1::kMaxChar) {
+      one_byte_chars_.push_back(static_cast<uint8_t>(c));
+      return;
+    }
+    ConvertToTwoByte();
+  }
+  if (c > unibrow::Utf16::kMaxNonSurrogateCharCode) {
+    two_byte_chars_.push_back(unibrow::Utf16::LeadSurrogate(c));
+    two_byte_chars_.push_back(unibrow::Utf16::TrailSurrogate(c));
+  } else {
+    two_byte_chars_.push_back(static_cast<base::uc16>(c));
+  }
+}
+
+void JsonStreamingParser::ConvertToTwoByte() {
+  DCHECK(is_one_byte_);
+  two_byte_chars_.reserve(std::max(one_byte_chars_.capacity(),
+                                   one_byte_chars_.size() + 1));
+  two_byte_chars_.assign(one_byte_chars_.begin(), one_byte_chars_.end());
+  std::vector<uint8_t>().swap(one_byte_chars_);
+  is_one_byte_ = false;
+}
+
+MaybeHandle<Object> JsonStreamingParser::Finish() {
+  DCHECK(!finished_);
+  finished_ = true;
+  if (encoding_ == Encoding::kUtf8) {
+    unibrow::uchar c = unibrow::Utf8::ValueOfIncrementalFinish(&utf8_state_);
+    if (c != unibrow::Utf8::kBufferEmpty) AppendCharacter(c);
+  }
+
+  Factory* factory = isolate_->factory();
+  Handle<Object> reviver = factory->undefined_value();
+  Handle<String> source;
+  if (is_one_byte_ ? one_byte_chars_.empty() : two_byte_chars_.empty()) {
+    return JsonParser<uint8_t>::Parse(isolate_, factory->empty_string(),
+                                      reviver);
+  }
+  if (is_one_byte_) {
+    auto resource =
+        std::make_unique<OneByteResource>(std::move(one_byte_chars_));
+    if (!factory->NewExternalStringFromOneByte(resource.get())
+             .ToHandle(&source)) {
+      return MaybeHandle<Object>();
+    }
+    resource.release();
+    return JsonParser<uint8_t>::Parse(isolate_, source, reviver);
+  }
+  auto resource = std::make_unique<TwoByteResource>(std::move(two_byte_chars_));
+  if (!factory->NewExternalStringFromTwoByte(resource.get())
+           .ToHandle(&source)) {
+    return MaybeHandle<Object>();
+  }
+  resource.release();
+  return JsonParser<uint16_t>::Parse(isolate_, source, reviver);
+}
+
+}  // namespace internal
+}  // namespace v8
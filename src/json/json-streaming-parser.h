@@ -0,0 +1,58 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_JSON_JSON_STREAMING_PARSER_H_
+#define V8_JSON_JSON_STREAMING_PARSER_H_
+
+#include <vector>
+
+#include "src/base/strings.h"
+#include "src/handles/maybe-handles.h"
+#include "src/strings/unicode.h"
+
+namespace v8 {
+namespace internal {
+
+class Isolate;
+class Object;
+
+// Collects JSON text that arrives in chunks, decoding UTF-8 on the fly, and
+// parses it once the last chunk arrived. The text is accumulated off-heap in
+// its final one-byte or two-byte representation and handed to the JsonParser
+// as an external string, so it is never concatenated or copied on the heap.
+// Append() doesn't access the heap.
+class JsonStreamingParser final {
+ public:
+  enum class Encoding { kOneByte, kUtf8 };
+
+  JsonStreamingParser(Isolate* isolate, Encoding encoding);
+  JsonStreamingParser(const JsonStreamingParser&) = delete;
+  JsonStreamingParser& operator=(const JsonStreamingParser&) = delete;
+
+  void Append(const uint8_t* data, size_t length);
+
+  V8_WARN_UNUSED_RESULT MaybeHandle<Object> Finish();
+
+ private:
+  class OneByteResource;
+  class TwoByteResource;
+
+  void AppendUtf8(const uint8_t* data, size_t length);
+  V8_INLINE void AppendCharacter(unibrow::uchar c);
+  void ConvertToTwoByte();
+
+  Isolate* const isolate_;
+  const Encoding encoding_;
+  bool is_one_byte_ = true;
+  bool finished_ = false;
+  std::vector<uint8_t> one_byte_chars_;
+  std::vector<base::uc16> two_byte_chars_;
+  unibrow::Utf8::State utf8_state_ = unibrow::Utf8::State::kAccept;
+  unibrow::Utf8::Utf8IncrementalBuffer utf8_incomplete_char_ = 0;
+};
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_JSON_JSON_STREAMING_PARSER_H_
@@ -4,10 +4,14 @@
 
 #include "src/json/json-stringifier.h"
 
+#include <vector>
+
+#include "include/v8-profiler.h"
 #include "src/base/strings.h"
 #include "src/common/assert-scope.h"
 #include "src/common/message-template.h"
 #include "src/execution/protectors-inl.h"
+#include "src/json/json-simd.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/elements-kind.h"
 #include "src/objects/heap-number-inl.h"
@@ -20,6 +24,7 @@
 #include "src/objects/smi.h"
 #include "src/objects/tagged.h"
 #include "src/strings/string-builder-inl.h"
+#include "src/strings/unicode-inl.h"
 
 namespace v8 {
 namespace internal {
@@ -38,6 +43,11 @@ class JsonStringifier {
                                                       Handle<Object> replacer,
                                                       Handle<Object> gap);
 
+  // Writes the result to {stream} as UTF-8 instead of creating a string.
+  // Returns false if the stream aborted.
+  V8_WARN_UNUSED_RESULT Maybe<bool> StringifyToStream(
+      Handle<Object> object, Handle<Object> gap, v8::OutputStream* stream);
+
  private:
   enum Result { UNCHANGED, SUCCESS, EXCEPTION, NEED_STACK };
 
@@ -86,6 +96,24 @@ class JsonStringifier {
     if V8_UNLIKELY (current_index_ == part_length_) Extend();
   }
 
+  template <typename SrcChar, typename DestChar>
+  V8_INLINE void AppendChars(base::Vector<const SrcChar> chars) {
+    DCHECK_EQ(encoding_ == String::ONE_BYTE_ENCODING, sizeof(DestChar) == 1);
+    while (!CurrentPartCanFit(chars.length())) {
+      // Fill the current part before extending it, so that the output is
+      // flushed in bounded pieces when writing to a stream.
+      int length = part_length_ - current_index_;
+      CopyChars(reinterpret_cast<DestChar*>(part_ptr_) + current_index_,
+                chars.begin(), length);
+      current_index_ += length;
+      chars = chars.SubVector(length, chars.length());
+      Extend();
+    }
+    CopyChars(reinterpret_cast<DestChar*>(part_ptr_) + current_index_,
+              chars.begin(), chars.length());
+    current_index_ += chars.length();
+  }
+
   V8_INLINE void AppendCharacter(uint8_t c) {
     if (encoding_ == String::ONE_BYTE_ENCODING) {
       Append<uint8_t, uint8_t>(c);
@@ -178,7 +206,8 @@ class JsonStringifier {
           encoding_ == String::TWO_BYTE_ENCODING ||
           (string->IsFlat() &&
            String::IsOneByteRepresentationUnderneath(string));
-      if (representation_ok) {
+      if (representation_ok &&
+          (stream_ == nullptr || CurrentPartCanFit(string->length()))) {
         while (!CurrentPartCanFit(string->length())) Extend();
         AppendStringByCopy(string, no_gc);
         return;
@@ -227,6 +256,13 @@ class JsonStringifier {
   // Returns whether any escape sequences were used.
   template <bool raw_json>
   bool SerializeString(Handle<String> object);
+  // Serializes a string longer than a stream chunk in slices, and passes the
+  // output to the stream in between, so that it isn't all buffered at once.
+  template <bool raw_json>
+  bool SerializeLongStringForStream(Handle<String> object);
+  template <bool raw_json>
+  bool SerializeStringSlice(Tagged<String> string, int start, int end,
+                            const DisallowGarbageCollection& no_gc);
 
   template <typename DestChar>
   class NoExtendBuilder {
@@ -253,6 +289,12 @@ class JsonStringifier {
       cursor_ += length;
     }
 
+    template <typename SrcChar>
+    V8_INLINE void AppendChars(base::Vector<const SrcChar> chars) {
+      CopyChars(cursor_, chars.begin(), chars.size());
+      cursor_ += chars.size();
+    }
+
    private:
     int* current_index_;
     DestChar* start_;
@@ -332,6 +374,9 @@ class JsonStringifier {
   template <typename SrcChar, typename DestChar, bool raw_json>
   V8_INLINE bool SerializeString_(Tagged<String> string,
                                   const DisallowGarbageCollection& no_gc);
+  // Same as above, but without the quotes.
+  template <typename SrcChar, typename DestChar, bool raw_json>
+  V8_INLINE bool SerializeStringChars_(base::Vector<const SrcChar> vector);
 
   // Tries to do fast-path serialization for a property key, and returns whether
   // it was successful.
@@ -342,6 +387,17 @@ class JsonStringifier {
   template <typename Char>
   V8_INLINE static bool DoNotEscape(Char c);
 
+  // Returns the index of the first character at or after {from} that may need
+  // escaping, or the length of {chars} if there is none. Runs of characters
+  // in between are copied to the output in bulk.
+  template <typename Char>
+  V8_INLINE static int FindEscapeIndex(base::Vector<const Char> chars,
+                                       int from) {
+    return static_cast<int>(
+        FindJsonEscapeCharacter(chars.begin() + from, chars.end()) -
+        chars.begin());
+  }
+
   V8_INLINE void NewLine();
   V8_NOINLINE void NewLineOutline();
   V8_INLINE void Indent() { indent_++; }
@@ -372,6 +428,23 @@ class JsonStringifier {
   V8_NOINLINE void Extend();
   V8_NOINLINE void ChangeEncoding();
 
+  // Encodes the current part as UTF-8 into the stream buffer and empties it.
+  // Unless this is the end of the output, a trailing lead surrogate is kept in
+  // the part. This doesn't call into the embedder, so it is fine to do while
+  // raw pointers into the heap are in use.
+  void EncodePartForStream(bool end_of_output);
+  template <typename Char>
+  void EncodeUtf8ForStream(const Char* chars, int length);
+  // Passes the stream buffer to the embedder in chunks. Unless this is the end
+  // of the output, only full chunks are written. The embedder may trigger a
+  // GC, so this must only be called while no raw pointers into the heap are
+  // in use.
+  void WriteToStream(bool end_of_output);
+  // Writes the stream buffer to the stream once it holds a full chunk, which
+  // bounds the buffer by the chunk size plus what was serialized since the
+  // last call. Returns false if the stream aborted.
+  bool FlushStreamChunks();
+
   Isolate* isolate_;
   String::Encoding encoding_;
   Handle<FixedArray> property_list_;
@@ -393,6 +466,13 @@ class JsonStringifier {
   SimplePropertyKeyCache key_cache_;
   uint8_t one_byte_array_[kInitialPartLength];
 
+  // The embedder stream the output is written to, if any, and the UTF-8 that
+  // wasn't passed to it yet.
+  v8::OutputStream* stream_ = nullptr;
+  std::vector<char> stream_buffer_;
+  int stream_chunk_size_ = 0;
+  bool stream_aborted_ = false;
+
   static const int kJsonEscapeTableEntrySize = 8;
   static const char* const JsonEscapeTable;
   static const bool JsonDoNotEscapeFlagTable[];
@@ -404,6 +484,13 @@ MaybeHandle<Object> JsonStringify(Isolate* isolate, Handle<Object> object,
   return stringifier.Stringify(object, replacer, gap);
 }
 
+Maybe<bool> JsonStringifyToStream(Isolate* isolate, Handle<Object> object,
+                                  Handle<Object> gap,
+                                  v8::OutputStream* stream) {
+  JsonStringifier stringifier(isolate);
+  return stringifier.StringifyToStream(object, gap, stream);
+}
+
 // Translation table to escape Latin1 characters.
 // Table entries start at a multiple of 8 and are null-terminated.
 const char* const JsonStringifier::JsonEscapeTable =
@@ -500,6 +587,34 @@ MaybeHandle<Object> JsonStringifier::Stringify(Handle<Object> object,
   return MaybeHandle<Object>();
 }
 
+Maybe<bool> JsonStringifier::StringifyToStream(Handle<Object> object,
+                                               Handle<Object> gap,
+                                               v8::OutputStream* stream) {
+  if (!IsUndefined(*gap, isolate_) && !InitializeGap(gap)) {
+    CHECK(isolate_->has_exception());
+    return Nothing<bool>();
+  }
+  stream_ = stream;
+  stream_chunk_size_ =
+      std::max(stream->GetChunkSize(),
+               static_cast<int>(unibrow::Utf8::kMaxEncodedSize));
+  // Output that was written to the stream can't be taken back to restart
+  // with a stack, so track the stack from the start.
+  need_stack_ = true;
+  Result result = SerializeObject(object);
+  if (result == EXCEPTION && isolate_->has_exception()) return Nothing<bool>();
+  if (stream_aborted_) return Just(false);
+  DCHECK_NE(result, EXCEPTION);
+  // Like v8::JSON::Stringify, which converts an undefined result to a string.
+  if (result == UNCHANGED) AppendCStringLiteral("undefined");
+  EncodePartForStream(true);
+  WriteToStream(true);
+  if (stream_aborted_) return Just(false);
+  DisallowJavascriptExecution no_js(isolate_);
+  stream->EndOfStream();
+  return Just(true);
+}
+
 bool JsonStringifier::InitializeReplacer(Handle<Object> replacer) {
   DCHECK(property_list_.is_null());
   DCHECK(replacer_function_.is_null());
@@ -649,6 +764,8 @@ JsonStringifier::Result JsonStringifier::StackPush(Handle<Object> object,
     }
     return SUCCESS;
   }
+  // Stop serializing once the stream has aborted.
+  if (V8_UNLIKELY(stream_aborted_)) return EXCEPTION;
   StackLimitCheck check(isolate_);
   if (check.HasOverflowed()) {
     isolate_->StackOverflow();
@@ -813,6 +930,11 @@ JsonStringifier::Result JsonStringifier::Serialize_(Handle<Object> object,
       IsException(isolate_->stack_guard()->HandleInterrupts(), isolate_)) {
     return EXCEPTION;
   }
+  // Between two values no raw pointers into the heap are in use, so this is
+  // where buffered output is passed to the embedder.
+  if (V8_UNLIKELY(stream_ != nullptr) && !FlushStreamChunks()) {
+    return EXCEPTION;
+  }
 
   Handle<Object> initial_value = object;
   PtrComprCageBase cage_base(isolate_);
@@ -1095,6 +1217,11 @@ JsonStringifier::Result JsonStringifier::SerializeFixedArrayWithInterruptCheck(
         USE(result);
         DCHECK_EQ(result, SUCCESS);
       }
+      // The elements are reloaded for every element, so the stream may
+      // trigger a GC here.
+      if (V8_UNLIKELY(stream_ != nullptr) && !FlushStreamChunks()) {
+        return EXCEPTION;
+      }
     }
     if (i >= length) return SUCCESS;
     DCHECK_LT(limit, kMaxAllowedFastPackedLength);
@@ -1375,12 +1502,15 @@ bool JsonStringifier::SerializeStringUnchecked_(
   DCHECK(sizeof(DestChar) >= sizeof(SrcChar));
   bool required_escaping = false;
   for (int i = 0; i < src.length(); i++) {
+    int run_end = raw_json ? src.length() : FindEscapeIndex(src, i);
+    dest->AppendChars(src.SubVector(i, run_end));
+    if (run_end == src.length()) break;
+    i = run_end;
     SrcChar c = src[i];
-    if (raw_json || DoNotEscape(c)) {
-      dest->Append(c);
-    } else if (sizeof(SrcChar) != 1 &&
-               base::IsInRange(c, static_cast<SrcChar>(0xD800),
-                               static_cast<SrcChar>(0xDFFF))) {
+    DCHECK(!DoNotEscape(c));
+    if (sizeof(SrcChar) != 1 &&
+        base::IsInRange(c, static_cast<SrcChar>(0xD800),
+                        static_cast<SrcChar>(0xDFFF))) {
       // The current character is a surrogate.
       required_escaping = true;
       if (c <= 0xDBFF) {
@@ -1433,13 +1563,20 @@ bool JsonStringifier::SerializeStringUnchecked_(
 template <typename SrcChar, typename DestChar, bool raw_json>
 bool JsonStringifier::SerializeString_(Tagged<String> string,
                                        const DisallowGarbageCollection& no_gc) {
-  int length = string->length();
-  bool required_escaping = false;
   if (!raw_json) Append<uint8_t, DestChar>('"');
+  bool required_escaping = SerializeStringChars_<SrcChar, DestChar, raw_json>(
+      string->GetCharVector<SrcChar>(no_gc));
+  if (!raw_json) Append<uint8_t, DestChar>('"');
+  return required_escaping;
+}
+
+template <typename SrcChar, typename DestChar, bool raw_json>
+bool JsonStringifier::SerializeStringChars_(
+    base::Vector<const SrcChar> vector) {
+  bool required_escaping = false;
   // We might be able to fit the whole escaped string in the current string
   // part, or we might need to allocate.
-  base::Vector<const SrcChar> vector = string->GetCharVector<SrcChar>(no_gc);
-  if V8_LIKELY (EscapedLengthIfCurrentPartFits(length)) {
+  if V8_LIKELY (EscapedLengthIfCurrentPartFits(vector.length())) {
     NoExtendBuilder<DestChar> no_extend(
         reinterpret_cast<DestChar*>(part_ptr_) + current_index_,
         &current_index_);
@@ -1447,12 +1584,15 @@ bool JsonStringifier::SerializeString_(Tagged<String> string,
         vector, &no_extend);
   } else {
     for (int i = 0; i < vector.length(); i++) {
+      int run_end = raw_json ? vector.length() : FindEscapeIndex(vector, i);
+      AppendChars<SrcChar, DestChar>(vector.SubVector(i, run_end));
+      if (run_end == vector.length()) break;
+      i = run_end;
       SrcChar c = vector.at(i);
-      if (raw_json || DoNotEscape(c)) {
-        Append<SrcChar, DestChar>(c);
-      } else if (sizeof(SrcChar) != 1 &&
-                 base::IsInRange(c, static_cast<SrcChar>(0xD800),
-                                 static_cast<SrcChar>(0xDFFF))) {
+      DCHECK(!DoNotEscape(c));
+      if (sizeof(SrcChar) != 1 &&
+          base::IsInRange(c, static_cast<SrcChar>(0xD800),
+                          static_cast<SrcChar>(0xDFFF))) {
         // The current character is a surrogate.
         required_escaping = true;
         if (c <= 0xDBFF) {
@@ -1500,7 +1640,6 @@ bool JsonStringifier::SerializeString_(Tagged<String> string,
       }
     }
   }
-  if (!raw_json) Append<uint8_t, DestChar>('"');
   return required_escaping;
 }
 
@@ -1606,6 +1745,10 @@ void JsonStringifier::SerializeDeferredKey(bool deferred_comma,
 template <bool raw_json>
 bool JsonStringifier::SerializeString(Handle<String> object) {
   object = String::Flatten(isolate_, object);
+  if (V8_UNLIKELY(stream_ != nullptr) &&
+      object->length() > stream_chunk_size_) {
+    return SerializeLongStringForStream<raw_json>(object);
+  }
   DisallowGarbageCollection no_gc;
   auto string = *object;
   if (encoding_ == String::ONE_BYTE_ENCODING) {
@@ -1623,7 +1766,63 @@ bool JsonStringifier::SerializeString(Handle<String> object) {
   }
 }
 
+template <bool raw_json>
+bool JsonStringifier::SerializeLongStringForStream(Handle<String> object) {
+  const int length = object->length();
+  bool required_escaping = false;
+  if (!raw_json) AppendCharacter('"');
+  for (int start = 0; start < length;) {
+    int end = std::min(length, start + stream_chunk_size_);
+    {
+      DisallowGarbageCollection no_gc;
+      Tagged<String> string = *object;
+      // Keep surrogate pairs in one slice, as they would be escaped otherwise.
+      if (end < length &&
+          unibrow::Utf16::IsLeadSurrogate(string->Get(end - 1)) &&
+          unibrow::Utf16::IsTrailSurrogate(string->Get(end))) {
+        end++;
+      }
+      required_escaping |=
+          SerializeStringSlice<raw_json>(string, start, end, no_gc);
+    }
+    start = end;
+    // The slice is done with the raw pointers into {object}.
+    if (!FlushStreamChunks()) break;
+  }
+  if (!raw_json) AppendCharacter('"');
+  return required_escaping;
+}
+
+template <bool raw_json>
+bool JsonStringifier::SerializeStringSlice(
+    Tagged<String> string, int start, int end,
+    const DisallowGarbageCollection& no_gc) {
+  if (encoding_ == String::ONE_BYTE_ENCODING) {
+    if (String::IsOneByteRepresentationUnderneath(string)) {
+      return SerializeStringChars_<uint8_t, uint8_t, raw_json>(
+          string->GetCharVector<uint8_t>(no_gc).SubVector(start, end));
+    } else {
+      ChangeEncoding();
+    }
+  }
+  DCHECK_EQ(encoding_, String::TWO_BYTE_ENCODING);
+  if (String::IsOneByteRepresentationUnderneath(string)) {
+    return SerializeStringChars_<uint8_t, base::uc16, raw_json>(
+        string->GetCharVector<uint8_t>(no_gc).SubVector(start, end));
+  } else {
+    return SerializeStringChars_<base::uc16, base::uc16, raw_json>(
+        string->GetCharVector<base::uc16>(no_gc).SubVector(start, end));
+  }
+}
+
 void JsonStringifier::Extend() {
+  if (stream_ != nullptr && current_index_ > 1) {
+    // Move the output to the stream buffer instead of growing the part. At
+    // most a lead surrogate is kept, so the current part is reused from now
+    // on.
+    EncodePartForStream(false);
+    return;
+  }
   if (part_length_ >= String::kMaxLength) {
     // Set the flag and carry on. Delay throwing the exception till the end.
     current_index_ = 0;
@@ -1639,15 +1838,90 @@ void JsonStringifier::Extend() {
     part_ptr_ = one_byte_ptr_;
   } else {
     base::uc16* tmp_ptr = new base::uc16[part_length_];
-    for (int i = 0; i < current_index_; i++) {
-      tmp_ptr[i] = two_byte_ptr_[i];
-    }
+    CopyChars(tmp_ptr, two_byte_ptr_, current_index_);
     delete[] two_byte_ptr_;
     two_byte_ptr_ = tmp_ptr;
     part_ptr_ = two_byte_ptr_;
   }
 }
 
+void JsonStringifier::EncodePartForStream(bool end_of_output) {
+  DCHECK_NOT_NULL(stream_);
+  if (encoding_ == String::ONE_BYTE_ENCODING) {
+    EncodeUtf8ForStream(one_byte_ptr_, current_index_);
+    current_index_ = 0;
+    return;
+  }
+  int length = current_index_;
+  if (!end_of_output && length > 0 &&
+      unibrow::Utf16::IsLeadSurrogate(two_byte_ptr_[length - 1])) {
+    length--;
+  }
+  EncodeUtf8ForStream(two_byte_ptr_, length);
+  if (length < current_index_) two_byte_ptr_[0] = two_byte_ptr_[length];
+  current_index_ -= length;
+}
+
+template <typename Char>
+void JsonStringifier::EncodeUtf8ForStream(const Char* chars, int length) {
+  if (stream_aborted_) return;
+  size_t start = stream_buffer_.size();
+  stream_buffer_.resize(start + static_cast<size_t>(length) *
+                                    unibrow::Utf8::kMax16BitCodeUnitSize);
+  char* buffer = stream_buffer_.data() + start;
+  int buffer_length = 0;
+  for (int i = 0; i < length; i++) {
+    unibrow::uchar c = chars[i];
+    if (c <= unibrow::Utf8::kMaxOneByteChar) {
+      buffer[buffer_length++] = static_cast<char>(c);
+      continue;
+    }
+    if (sizeof(Char) == 2 && i + 1 < length &&
+        unibrow::Utf16::IsSurrogatePair(c, chars[i + 1])) {
+      c = unibrow::Utf16::CombineSurrogatePair(c, chars[++i]);
+    }
+    // Lone surrogates, which can only come from the gap, are replaced.
+    buffer_length +=
+        unibrow::Utf8::Encode(buffer + buffer_length, c,
+                              unibrow::Utf16::kNoPreviousCharacter, true);
+  }
+  stream_buffer_.resize(start + buffer_length);
+}
+
+bool JsonStringifier::FlushStreamChunks() {
+  DCHECK_NOT_NULL(stream_);
+  if (stream_buffer_.size() >= static_cast<size_t>(stream_chunk_size_)) {
+    WriteToStream(false);
+  }
+  return !stream_aborted_;
+}
+
+void JsonStringifier::WriteToStream(bool end_of_output) {
+  if (stream_aborted_) return;
+  // The objects being serialized must not change under our feet.
+  DisallowJavascriptExecution no_js(isolate_);
+  const size_t size = stream_buffer_.size();
+  const size_t chunk_size = static_cast<size_t>(stream_chunk_size_);
+  size_t written = 0;
+  while (size - written >= chunk_size || (end_of_output && written < size)) {
+    size_t length = std::min(chunk_size, size - written);
+    // Don't split a character across chunks.
+    while (written + length < size &&
+           (stream_buffer_[written + length] & 0xC0) == 0x80) {
+      length--;
+    }
+    if (stream_->WriteAsciiChunk(stream_buffer_.data() + written,
+                                 static_cast<int>(length)) ==
+        v8::OutputStream::kAbort) {
+      stream_aborted_ = true;
+      break;
+    }
+    written += length;
+  }
+  stream_buffer_.erase(stream_buffer_.begin(),
+                       stream_buffer_.begin() + written);
+}
+
 void JsonStringifier::ChangeEncoding() {
   encoding_ = String::TWO_BYTE_ENCODING;
   two_byte_ptr_ = new base::uc16[part_length_];
@@ -15,6 +15,8 @@ namespace internal {
 #define HISTOGRAM_RANGE_LIST(HR)                                               \
   HR(code_cache_reject_reason, V8.CodeCacheRejectReason, 1, 9, 9)              \
   HR(errors_thrown_per_context, V8.ErrorsThrownPerContext, 0, 200, 20)         \
+  /* Number of pending microtasks at the start of a checkpoint. */             \
+  HR(microtask_queue_depth, V8.MicrotaskQueueDepth, 1, 100000, 50)             \
   HR(incremental_marking_reason, V8.GCIncrementalMarkingReason, 0,             \
      kGarbageCollectionReasonMaxValue, kGarbageCollectionReasonMaxValue + 1)   \
   HR(incremental_marking_sum, V8.GCIncrementalMarkingSum, 0, 10000, 101)       \
@@ -76,6 +78,9 @@ namespace internal {
      0, 1, 2)                                                                  \
   /* Ticks observed in a single Turbofan compilation, in 1K. */                \
   HR(turbofan_ticks, V8.TurboFan1KTicks, 0, 100000, 200)                       \
+  /* Length of the concurrent Turbofan input queue when a job is queued. */    \
+  HR(turbofan_optimize_queue_length, V8.TurboFanOptimizeQueueLength, 0, 64,    \
+     65)                                                                       \
   /* Backtracks observed in a single regexp interpreter execution. */          \
   /* The maximum of 100M backtracks takes roughly 2 seconds on my machine. */  \
   HR(regexp_backtracks, V8.RegExpBacktracks, 1, 100000000, 50)                 \
@@ -248,6 +253,10 @@ namespace internal {
      1000000, MICROSECOND)                                                     \
   HT(turbofan_osr_total_time,                                                  \
      V8.TurboFanOptimizeForOnStackReplacementTotalTime, 10000000, MICROSECOND) \
+  HT(turbofan_optimize_queue_wait, V8.TurboFanOptimizeQueueWait, 10000000,     \
+     MICROSECOND)                                                              \
+  HT(turbofan_osr_queue_wait,                                                  \
+     V8.TurboFanOptimizeForOnStackReplacementQueueWait, 10000000, MICROSECOND) \
   /* Wasm timers. */                                                           \
   HT(wasm_compile_asm_module_time, V8.WasmCompileModuleMicroSeconds.asm,       \
      10000000, MICROSECOND)                                                    \
@@ -361,7 +370,18 @@ namespace internal {
   SC(enum_cache_misses, V8.EnumCacheMisses)                                    \
   SC(maps_created, V8.MapsCreated)                                             \
   SC(megamorphic_stub_cache_updates, V8.MegamorphicStubCacheUpdates)           \
+  SC(megamorphic_stub_cache_resizes, V8.MegamorphicStubCacheResizes)           \
+  /* Turbofan jobs dropped from a full queue to make room for OSR. */          \
+  SC(turbofan_optimize_jobs_evicted, V8.TurboFanOptimizeJobsEvicted)           \
+  /* Queued Turbofan jobs that went stale, e.g. after a deopt. */              \
+  SC(turbofan_optimize_jobs_dropped, V8.TurboFanOptimizeJobsDropped)           \
+  /* Sites that deoptimized repeatedly and had their feedback generalized. */  \
+  SC(deopt_loops_detected, V8.DeoptLoopsDetected)                              \
+  SC(shared_constant_pools, V8.SharedConstantPools)                            \
   SC(regexp_entry_runtime, V8.RegExpEntryRuntime)                              \
+  /* Cons strings flattened, and the characters copied to flatten them. */     \
+  SC(string_flatten_count, V8.StringFlattenCount)                              \
+  SC(string_flatten_chars, V8.StringFlattenChars)                              \
   SC(stack_interrupts, V8.StackInterrupts)                                     \
   SC(new_space_bytes_available, V8.MemoryNewSpaceBytesAvailable)               \
   SC(new_space_bytes_committed, V8.MemoryNewSpaceBytesCommitted)               \
@@ -385,12 +405,17 @@ namespace internal {
 
 // List of counters that can be incremented from generated code. We need them in
 // a separate list to be able to relocate them.
-#define STATS_COUNTER_NATIVE_CODE_LIST(SC)                         \
-  /* Number of write barriers executed at runtime. */              \
-  SC(write_barriers, V8.WriteBarriers)                             \
-  SC(regexp_entry_native, V8.RegExpEntryNative)                    \
-  SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes) \
-  SC(megamorphic_stub_cache_misses, V8.MegamorphicStubCacheMisses)
+#define STATS_COUNTER_NATIVE_CODE_LIST(SC)                                   \
+  /* Number of write barriers executed at runtime. */                        \
+  SC(write_barriers, V8.WriteBarriers)                                       \
+  SC(regexp_entry_native, V8.RegExpEntryNative)                              \
+  SC(megamorphic_stub_cache_probes, V8.MegamorphicStubCacheProbes)           \
+  SC(megamorphic_stub_cache_primary_hits, V8.MegamorphicStubCachePrimaryHits) \
+  SC(megamorphic_stub_cache_secondary_hits,                                  \
+     V8.MegamorphicStubCacheSecondaryHits)                                   \
+  SC(megamorphic_stub_cache_misses, V8.MegamorphicStubCacheMisses)           \
+  /* Number of awaits on promises that were already fulfilled. */            \
+  SC(awaits_on_fulfilled_promises, V8.AwaitsOnFulfilledPromises)
 
 }  // namespace internal
 }  // namespace v8
@@ -175,7 +175,9 @@ class RuntimeCallTimer final {
   V(Isolate_DateTimeConfigurationChangeNotification)       \
   V(Isolate_LocaleConfigurationChangeNotification)         \
   V(JSON_Parse)                                            \
+  V(JSON_ParseStreaming)                                   \
   V(JSON_Stringify)                                        \
+  V(JSON_StringifyToStream)                                \
   V(Map_AsArray)                                           \
   V(Map_Clear)                                             \
   V(Map_Delete)                                            \
@@ -6,6 +6,7 @@
 
 #include <algorithm>
 #include <limits>
+#include <optional>
 
 #include "src/base/bounds.h"
 #include "src/base/logging.h"
@@ -7782,6 +7783,81 @@ void MaglevGraphBuilder::BuildCallWithFeedback(
                              SetAccumulator);
 }
 
+ReduceResult MaglevGraphBuilder::TryReducePolymorphicCall(
+    Phi* target_phi, CallArguments& args,
+    const compiler::FeedbackSource& feedback_source,
+    SpeculationMode speculation_mode) {
+  if (!v8_flags.maglev_polymorphic_inlining) return ReduceResult::Fail();
+  if (args.mode() != CallArguments::kDefault) return ReduceResult::Fail();
+  // Loop phis don't have their backedge input yet, so we can't know all the
+  // values they can take.
+  if (target_phi->is_loop_phi() || target_phi->is_exception_phi()) {
+    return ReduceResult::Fail();
+  }
+
+  // Polymorphic property loads (e.g. `visitor.visit(node)` with a few visitor
+  // classes) merge one constant per receiver map. If every input of the phi is
+  // a known JSFunction, the call target is exactly one of them, and we can
+  // dispatch on the target and reduce (and maybe inline) each call separately.
+  base::SmallVector<compiler::JSFunctionRef, 4> targets;
+  for (int i = 0; i < target_phi->input_count(); i++) {
+    compiler::OptionalHeapObjectRef maybe_constant =
+        TryGetConstant(target_phi->input(i).node());
+    if (!maybe_constant || !maybe_constant->IsJSFunction()) {
+      return ReduceResult::Fail();
+    }
+    compiler::JSFunctionRef target = maybe_constant->AsJSFunction();
+    auto is_target = [&](compiler::JSFunctionRef t) {
+      return t.equals(target);
+    };
+    if (std::any_of(targets.begin(), targets.end(), is_target)) continue;
+    if (static_cast<int>(targets.size()) >=
+        v8_flags.max_maglev_polymorphic_call_targets) {
+      return ReduceResult::Fail();
+    }
+    targets.push_back(target);
+  }
+  // A single distinct target is a constant in disguise.
+  if (targets.size() < 2) return ReduceResult::Fail();
+
+  TRACE_INLINING("  polymorphic call with " << targets.size() << " targets");
+
+  MaglevSubGraphBuilder sub_graph(this, 1);
+  MaglevSubGraphBuilder::Variable ret_val(0);
+  MaglevSubGraphBuilder::Label done(
+      &sub_graph, static_cast<int>(targets.size()), {&ret_val});
+  bool reaches_done = false;
+  for (size_t i = 0; i < targets.size(); i++) {
+    compiler::JSFunctionRef target = targets[i];
+    // The last target needs no check, the phi can't hold anything else.
+    bool is_last = i == targets.size() - 1;
+    std::optional<MaglevSubGraphBuilder::Label> next;
+    if (!is_last) {
+      next.emplace(&sub_graph, 1);
+      sub_graph.GotoIfFalse<BranchIfReferenceEqual>(
+          &next.value(), {target_phi, GetConstant(target)});
+    }
+    // Each reduction may rewrite the arguments (e.g. the receiver), so give
+    // every target its own copy.
+    CallArguments target_args = args;
+    ReduceResult result = ReduceCallForConstant(
+        target, target_args, feedback_source, speculation_mode);
+    if (result.IsDoneWithAbort()) {
+      DCHECK_NULL(current_block_);
+      sub_graph.GotoOrTrim(&done);
+    } else {
+      DCHECK(result.IsDoneWithValue());
+      sub_graph.set(ret_val, result.value());
+      sub_graph.Goto(&done);
+      reaches_done = true;
+    }
+    if (!is_last) sub_graph.Bind(&next.value());
+  }
+  if (!reaches_done) return ReduceResult::DoneWithAbort();
+  sub_graph.Bind(&done);
+  return sub_graph.get(ret_val);
+}
+
 ReduceResult MaglevGraphBuilder::ReduceCall(
     ValueNode* target_node, CallArguments& args,
     const compiler::FeedbackSource& feedback_source,
@@ -7796,6 +7872,12 @@ ReduceResult MaglevGraphBuilder::ReduceCall(
     }
   }
 
+  if (Phi* target_phi = target_node->TryCast<Phi>()) {
+    ReduceResult result = TryReducePolymorphicCall(
+        target_phi, args, feedback_source, speculation_mode);
+    RETURN_IF_DONE(result);
+  }
+
   // If the implementation here becomes more complex, we could probably
   // deduplicate the code for FastCreateClosure and CreateClosure by using
   // templates or giving them a shared base class.
@@ -1777,6 +1777,10 @@ class MaglevGraphBuilder {
       ValueNode* target_node, compiler::JSFunctionRef target,
       CallArguments& args, const compiler::FeedbackSource& feedback_source,
       SpeculationMode speculation_mode);
+  ReduceResult TryReducePolymorphicCall(
+      Phi* target_phi, CallArguments& args,
+      const compiler::FeedbackSource& feedback_source,
+      SpeculationMode speculation_mode);
   ReduceResult ReduceCallForNewClosure(
       ValueNode* target_node, ValueNode* target_context,
       compiler::SharedFunctionInfoRef shared,
@@ -5,6 +5,8 @@
 #ifndef V8_OBJECTS_DICTIONARY_INL_H_
 #define V8_OBJECTS_DICTIONARY_INL_H_
 
+#include <type_traits>
+
 #include "src/base/optional.h"
 #include "src/execution/isolate-utils-inl.h"
 #include "src/numbers/hash-seed-inl.h"
@@ -116,6 +118,16 @@ PropertyDetails Dictionary<Derived, Shape>::DetailsAt(InternalIndex entry) {
 template <typename Derived, typename Shape>
 void Dictionary<Derived, Shape>::DetailsAtPut(InternalIndex entry,
                                               PropertyDetails value) {
+  if constexpr (std::is_same_v<Derived, NameDictionary>) {
+    // Entries that are being added don't have details yet.
+    Tagged<Object> old_details = this->get(
+        DerivedHashTable::EntryToIndex(entry) + Derived::kEntryDetailsIndex);
+    if (IsSmi(old_details) &&
+        PropertyDetails(Smi::cast(old_details)).IsDontEnum() !=
+            value.IsDontEnum()) {
+      Derived::cast(*this)->ClearEnumKeysCache();
+    }
+  }
   Shape::DetailsAtPut(Derived::cast(*this), entry, value);
 }
 
@@ -267,6 +279,19 @@ void NameDictionary::set_flags(uint32_t flags) {
 BIT_FIELD_ACCESSORS(NameDictionary, flags, may_have_interesting_properties,
                     NameDictionary::MayHaveInterestingPropertiesBit)
 
+Tagged<Object> NameDictionary::enum_keys_cache() const {
+  return this->get(kEnumKeysCacheIndex);
+}
+
+void NameDictionary::set_enum_keys_cache(Tagged<Object> cache) {
+  this->set(kEnumKeysCacheIndex, cache);
+}
+
+void NameDictionary::ClearEnumKeysCache() {
+  Tagged<Object> undefined = GetReadOnlyRoots().undefined_value();
+  if (enum_keys_cache() != undefined) set_enum_keys_cache(undefined);
+}
+
 Tagged<PropertyCell> GlobalDictionary::CellAt(InternalIndex entry) {
   PtrComprCageBase cage_base = GetPtrComprCageBase(*this);
   return CellAt(cage_base, entry);
@@ -163,7 +163,7 @@ class BaseNameDictionaryShape : public BaseDictionaryShape<Handle<Name>> {
 
 class NameDictionaryShape : public BaseNameDictionaryShape {
  public:
-  static const int kPrefixSize = 3;
+  static const int kPrefixSize = 4;
   static const int kEntrySize = 3;
   static const bool kMatchNeedsHoleCheck = false;
 };
@@ -234,6 +234,7 @@ class V8_EXPORT_PRIVATE NameDictionary
   DECL_PRINTER(NameDictionary)
 
   static const int kFlagsIndex = kObjectHashIndex + 1;
+  static const int kEnumKeysCacheIndex = kFlagsIndex + 1;
   static const int kEntryValueIndex = 1;
   static const int kEntryDetailsIndex = 2;
   static const int kInitialCapacity = 2;
@@ -253,6 +254,20 @@ class V8_EXPORT_PRIVATE NameDictionary
   inline uint32_t flags() const;
   inline void set_flags(uint32_t flags);
 
+  // The enumerable string keys of the dictionary in enumeration order, cached
+  // by KeyAccumulator::GetOwnEnumPropertyKeys. Either undefined or a
+  // FixedArray that starts with the number of elements and the next
+  // enumeration index of the dictionary at the time the cache was filled.
+  // Adding or deleting a property changes one of those and thereby
+  // invalidates the cache; making a property (non-)enumerable clears it.
+  static const int kEnumKeysCacheNumberOfElementsIndex = 0;
+  static const int kEnumKeysCacheNextEnumerationIndexIndex = 1;
+  static const int kEnumKeysCacheKeysStartIndex = 2;
+
+  inline Tagged<Object> enum_keys_cache() const;
+  inline void set_enum_keys_cache(Tagged<Object> cache);
+  inline void ClearEnumKeysCache();
+
   // Creates a new NameDictionary.
   template <typename IsolateT>
   V8_WARN_UNUSED_RESULT static Handle<NameDictionary> New(
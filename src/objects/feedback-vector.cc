@@ -1363,6 +1363,28 @@ CompareOperationHint FeedbackNexus::GetCompareOperationFeedback() const {
   return CompareOperationHintFromFeedback(feedback);
 }
 
+bool FeedbackNexus::GeneralizeOperationFeedback() {
+  DCHECK(kind() == FeedbackSlotKind::kBinaryOp ||
+         kind() == FeedbackSlotKind::kCompareOp);
+  int feedback = GetFeedback().ToSmi().value();
+  int generalized;
+  if (kind() == FeedbackSlotKind::kBinaryOp) {
+    // Smi feedback is widened to Number, everything else to Any.
+    generalized =
+        (feedback & ~BinaryOperationFeedback::kSignedSmallInputs) == 0
+            ? BinaryOperationFeedback::kNumber
+            : BinaryOperationFeedback::kAny;
+  } else {
+    generalized = (feedback & ~CompareOperationFeedback::kSignedSmall) == 0
+                      ? CompareOperationFeedback::kNumber
+                      : CompareOperationFeedback::kAny;
+  }
+  generalized |= feedback;
+  if (generalized == feedback) return false;
+  SetFeedback(Smi::FromInt(generalized), SKIP_WRITE_BARRIER);
+  return true;
+}
+
 ForInHint FeedbackNexus::GetForInFeedback() const {
   DCHECK_EQ(kind(), FeedbackSlotKind::kForIn);
   int feedback = GetFeedback().ToSmi().value();
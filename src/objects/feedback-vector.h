@@ -866,6 +866,10 @@ class V8_EXPORT_PRIVATE FeedbackNexus final {
 
   BinaryOperationHint GetBinaryOperationFeedback() const;
   CompareOperationHint GetCompareOperationFeedback() const;
+  // For BinaryOp and CompareOp ICs. Widens the feedback to a more general
+  // state (e.g. SignedSmall to Number), so that optimizing compilers stop
+  // speculating on the narrower one. Returns true if the feedback changed.
+  bool GeneralizeOperationFeedback();
   ForInHint GetForInFeedback() const;
 
   // For KeyedLoad ICs.
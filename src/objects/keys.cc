@@ -930,6 +930,60 @@ Handle<FixedArray> GetOwnEnumPropertyDictionaryKeys(Isolate* isolate,
   return storage;
 }
 
+// Like GetOwnEnumPropertyDictionaryKeys for the NameDictionary of {object},
+// but reuses the keys cached on the dictionary while they are still valid.
+// The result is always a copy, so that callers can't leak the cache.
+Handle<FixedArray> GetOwnEnumPropertyNameDictionaryKeys(
+    Isolate* isolate, Handle<JSObject> object) {
+  Handle<NameDictionary> dictionary(object->property_dictionary(), isolate);
+  const int nof = dictionary->NumberOfElements();
+  if (nof == 0) return isolate->factory()->empty_fixed_array();
+  if (!v8_flags.dictionary_enum_keys_cache) {
+    return GetOwnEnumPropertyDictionaryKeys(
+        isolate, KeyCollectionMode::kOwnOnly, nullptr, object, *dictionary);
+  }
+
+  const int next_enumeration_index = dictionary->next_enumeration_index();
+  const int start = NameDictionary::kEnumKeysCacheKeysStartIndex;
+  Tagged<Object> maybe_cache = dictionary->enum_keys_cache();
+  if (IsFixedArray(maybe_cache)) {
+    Handle<FixedArray> cache(FixedArray::cast(maybe_cache), isolate);
+    if (Smi::ToInt(cache->get(
+            NameDictionary::kEnumKeysCacheNumberOfElementsIndex)) == nof &&
+        Smi::ToInt(cache->get(
+            NameDictionary::kEnumKeysCacheNextEnumerationIndexIndex)) ==
+            next_enumeration_index) {
+      isolate->counters()->enum_cache_hits()->Increment();
+      int length = cache->length() - start;
+      if (length == 0) return isolate->factory()->empty_fixed_array();
+      Handle<FixedArray> keys = isolate->factory()->NewFixedArray(length);
+      DisallowGarbageCollection no_gc;
+      Tagged<FixedArray> raw_keys = *keys;
+      WriteBarrierMode mode = raw_keys->GetWriteBarrierMode(no_gc);
+      raw_keys->CopyElements(isolate, 0, *cache, start, length, mode);
+      return keys;
+    }
+  }
+
+  isolate->counters()->enum_cache_misses()->Increment();
+  Handle<FixedArray> keys = GetOwnEnumPropertyDictionaryKeys(
+      isolate, KeyCollectionMode::kOwnOnly, nullptr, object, *dictionary);
+  int length = keys->length();
+  Handle<FixedArray> cache = isolate->factory()->NewFixedArray(start + length);
+  {
+    DisallowGarbageCollection no_gc;
+    Tagged<FixedArray> raw_cache = *cache;
+    raw_cache->set(NameDictionary::kEnumKeysCacheNumberOfElementsIndex,
+                   Smi::FromInt(nof));
+    raw_cache->set(NameDictionary::kEnumKeysCacheNextEnumerationIndexIndex,
+                   Smi::FromInt(next_enumeration_index));
+    WriteBarrierMode mode = raw_cache->GetWriteBarrierMode(no_gc);
+    raw_cache->CopyElements(isolate, start, *keys, 0, length, mode);
+  }
+  dictionary->set_enum_keys_cache(*cache);
+  return keys;
+}
+
 // Collect the keys from |dictionary| into |keys|, in ascending chronological
 // order of property creation.
 template <typename Dictionary>
@@ -1179,9 +1233,7 @@ Handle<FixedArray> KeyAccumulator::GetOwnEnumPropertyKeys(
         isolate, KeyCollectionMode::kOwnOnly, nullptr, object,
         object->property_dictionary_swiss());
   } else {
-    return GetOwnEnumPropertyDictionaryKeys(
-        isolate, KeyCollectionMode::kOwnOnly, nullptr, object,
-        object->property_dictionary());
+    return GetOwnEnumPropertyNameDictionaryKeys(isolate, object);
   }
 }
 
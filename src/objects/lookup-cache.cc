@@ -4,6 +4,9 @@
 
 #include "src/objects/lookup-cache.h"
 
+#include "src/base/functional.h"
+#include "src/objects/objects-inl.h"
+
 namespace v8 {
 namespace internal {
 
@@ -11,5 +14,49 @@ void DescriptorLookupCache::Clear() {
   for (int index = 0; index < kLength; index++) keys_[index].source = Map();
 }
 
+namespace {
+
+bool IsShareableConstantPoolEntry(Tagged<Object> entry) {
+  if (IsSmi(entry)) return true;
+  Tagged<HeapObject> object = HeapObject::cast(entry);
+  return InReadOnlySpace(object) || IsInternalizedString(object);
+}
+
+uint32_t ConstantPoolEntryHash(Tagged<Object> entry) {
+  if (IsSmi(entry)) return static_cast<uint32_t>(Smi::ToInt(entry));
+  if (IsInternalizedString(entry)) return String::cast(entry)->hash();
+  // Read-only objects never move.
+  return static_cast<uint32_t>(entry.ptr()) >> kTaggedSizeLog2;
+}
+
+}  // namespace
+
+Tagged<TrustedFixedArray> ConstantPoolCache::Canonicalize(
+    Tagged<TrustedFixedArray> pool) {
+  int length = pool->length();
+  if (length == 0 || length > kMaxPoolLength) return pool;
+  size_t hash = static_cast<size_t>(length);
+  for (int i = 0; i < length; i++) {
+    Tagged<Object> entry = pool->get(i);
+    if (!IsShareableConstantPoolEntry(entry)) return pool;
+    hash = base::hash_combine(hash, ConstantPoolEntryHash(entry));
+  }
+
+  Tagged<TrustedFixedArray>& cached = pools_[hash % kLength];
+  if (!cached.is_null() && cached->length() == length) {
+    int i = 0;
+    while (i < length && cached->get(i) == pool->get(i)) i++;
+    if (i == length) return cached;
+  }
+  cached = pool;
+  return pool;
+}
+
+void ConstantPoolCache::Clear() {
+  for (int index = 0; index < kLength; index++) {
+    pools_[index] = Tagged<TrustedFixedArray>();
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
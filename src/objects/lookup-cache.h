@@ -5,6 +5,7 @@
 #ifndef V8_OBJECTS_LOOKUP_CACHE_H_
 #define V8_OBJECTS_LOOKUP_CACHE_H_
 
+#include "src/objects/fixed-array.h"
 #include "src/objects/map.h"
 #include "src/objects/name.h"
 #include "src/objects/objects.h"
@@ -55,6 +56,35 @@ class DescriptorLookupCache {
   friend class Isolate;
 };
 
+// Cache of recently created bytecode constant pools, so that functions whose
+// constant pools have identical entries can share a single constant pool.
+// Only pools made of Smis, internalized strings and read-only objects are
+// cached, as those entries mean the same in every function.
+// Cleared at startup and prior to any mark-compact gc.
+class ConstantPoolCache {
+ public:
+  ConstantPoolCache(const ConstantPoolCache&) = delete;
+  ConstantPoolCache& operator=(const ConstantPoolCache&) = delete;
+
+  // Returns a cached constant pool with the same entries as {pool} if there
+  // is one, and otherwise caches {pool} and returns it.
+  Tagged<TrustedFixedArray> Canonicalize(Tagged<TrustedFixedArray> pool);
+
+  // Clear the cache.
+  void Clear();
+
+ private:
+  ConstantPoolCache() { Clear(); }
+
+  // Larger constant pools are rarely identical.
+  static const int kMaxPoolLength = 16;
+  static const int kLength = 256;
+
+  Tagged<TrustedFixedArray> pools_[kLength];
+
+  friend class Isolate;
+};
+
 }  // namespace internal
 }  // namespace v8
 
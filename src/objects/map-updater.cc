@@ -424,12 +424,60 @@ MapUpdater::State MapUpdater::Normalize(const char* reason) {
   return state_;  // Done.
 }
 
+namespace {
+
+// If objects of {initial_map} ended up with more fields than it has in-object
+// properties, raises the expected number of properties of its constructor to
+// at least the number of fields actually used, so that initial maps created
+// for the constructor later on (e.g. for other closures of the same function)
+// reserve in-object space for those fields.
+void LearnExpectedNofProperties(Tagged<Map> initial_map, int field_count) {
+  if (field_count <= initial_map->GetInObjectProperties()) return;
+  Tagged<Object> maybe_constructor = initial_map->GetConstructor();
+  if (!IsJSFunction(maybe_constructor)) return;
+  Tagged<JSFunction> constructor = JSFunction::cast(maybe_constructor);
+  // Subclass instances share the base constructor; only learn from the
+  // constructor's own initial map.
+  if (!constructor->has_initial_map() ||
+      constructor->initial_map() != initial_map) {
+    return;
+  }
+  Tagged<SharedFunctionInfo> shared = constructor->shared();
+  static_assert(JSObject::kMaxInObjectProperties <= kMaxUInt8);
+  int expected =
+      std::min(std::max(shared->expected_nof_properties(), field_count),
+               JSObject::kMaxInObjectProperties);
+  shared->set_expected_nof_properties(expected);
+  // Don't let a recompilation overwrite the learned value with the parser's
+  // estimate.
+  shared->set_are_properties_final(true);
+}
+
+}  // namespace
+
 // static
 void MapUpdater::CompleteInobjectSlackTracking(Isolate* isolate,
                                                Tagged<Map> initial_map) {
   // Has to be an initial map.
   DCHECK(IsUndefined(initial_map->GetBackPointer(), isolate));
 
+  if (V8_UNLIKELY(v8_flags.slack_tracking_learn_shapes ||
+                  v8_flags.trace_transition_tree_shapes)) {
+    Map::TransitionTreeStats stats =
+        initial_map->ComputeTransitionTreeStats(isolate);
+    if (v8_flags.trace_transition_tree_shapes) {
+      StdoutStream os;
+      os << "[completing slack tracking for " << Brief(initial_map) << ": "
+         << stats.map_count << " maps, depth " << stats.max_depth << ", "
+         << stats.max_field_count << " fields ("
+         << initial_map->GetInObjectProperties() << " in-object), "
+         << stats.reordered_shape_count << " reordered shapes]" << std::endl;
+    }
+    if (v8_flags.slack_tracking_learn_shapes) {
+      LearnExpectedNofProperties(initial_map, stats.max_field_count);
+    }
+  }
+
   const int slack = initial_map->ComputeMinObjectSlack(isolate);
   DCHECK_GE(slack, 0);
 
@@ -4,6 +4,8 @@
 
 #include "src/objects/map.h"
 
+#include <unordered_map>
+
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/execution/frames.h"
@@ -2284,6 +2286,67 @@ int Map::ComputeMinObjectSlack(Isolate* isolate) {
   return slack;
 }
 
+namespace {
+
+// Returns true if {a} and {b} own the same properties, added in a different
+// order. Both maps must have the same number of own descriptors.
+bool HaveSamePropertiesInDifferentOrder(Tagged<Map> a, Tagged<Map> b) {
+  int nof = a->NumberOfOwnDescriptors();
+  DCHECK_EQ(nof, b->NumberOfOwnDescriptors());
+  Tagged<DescriptorArray> a_descriptors = a->instance_descriptors();
+  Tagged<DescriptorArray> b_descriptors = b->instance_descriptors();
+  bool same_order = true;
+  for (InternalIndex i : InternalIndex::Range(nof)) {
+    Tagged<Name> key = b_descriptors->GetKey(i);
+    if (a_descriptors->GetKey(i) == key) continue;
+    same_order = false;
+    if (a_descriptors->Search(key, nof).is_not_found()) return false;
+  }
+  return !same_order;
+}
+
+}  // namespace
+
+Map::TransitionTreeStats Map::ComputeTransitionTreeStats(Isolate* isolate) {
+  // Has to be an initial map.
+  DCHECK(IsUndefined(GetBackPointer(), isolate));
+
+  TransitionTreeStats stats;
+  const int root_descriptors = NumberOfOwnDescriptors();
+  // Maps with own descriptors, keyed by an order-independent fingerprint of
+  // their property set. Maps that differ only in elements kind, attributes or
+  // prototype have the same key order and don't count as reordered.
+  std::unordered_multimap<Address, Tagged<Map>> shapes;
+  DisallowGarbageCollection no_gc;
+  TransitionsAccessor transitions(isolate, *this);
+  TransitionsAccessor::TraverseCallback callback = [&](Tagged<Map> map) {
+    stats.map_count++;
+    int nof = map->NumberOfOwnDescriptors();
+    stats.max_depth = std::max(stats.max_depth, nof - root_descriptors);
+    stats.max_field_count =
+        std::max(stats.max_field_count,
+                 map->NumberOfFields(ConcurrencyMode::kSynchronous));
+    if (nof == 0) return;
+    Tagged<DescriptorArray> descriptors = map->instance_descriptors();
+    Address fingerprint = static_cast<Address>(nof);
+    for (InternalIndex i : InternalIndex::Range(nof)) {
+      fingerprint += descriptors->GetKey(i).ptr();
+    }
+    auto range = shapes.equal_range(fingerprint);
+    for (auto it = range.first; it != range.second; ++it) {
+      Tagged<Map> other = it->second;
+      if (other->NumberOfOwnDescriptors() == nof &&
+          HaveSamePropertiesInDifferentOrder(other, map)) {
+        stats.reordered_shape_count++;
+        break;
+      }
+    }
+    shapes.emplace(fingerprint, map);
+  };
+  transitions.TraverseTransitionTree(callback);
+  return stats;
+}
+
 void Map::SetInstanceDescriptors(Isolate* isolate,
                                  Tagged<DescriptorArray> descriptors,
                                  int number_of_own_descriptors) {
@@ -384,6 +384,20 @@ class Map : public TorqueGeneratedMap<Map, HeapObject> {
   // Computes inobject slack for the transition tree starting at this initial
   // map.
   int ComputeMinObjectSlack(Isolate* isolate);
+
+  // Shape statistics of the transition tree starting at this initial map.
+  struct TransitionTreeStats {
+    // Number of maps in the tree, including the initial map.
+    int map_count = 0;
+    // Largest number of own descriptors added on top of the initial map.
+    int max_depth = 0;
+    // Largest number of fields of any map in the tree.
+    int max_field_count = 0;
+    // Number of maps that have the same set of own properties as another map
+    // in the tree, but added in a different order.
+    int reordered_shape_count = 0;
+  };
+  TransitionTreeStats ComputeTransitionTreeStats(Isolate* isolate);
   inline int InstanceSizeFromSlack(int slack) const;
 
   // Tells whether the object in the prototype property will be used
@@ -5451,6 +5451,7 @@ Handle<NameDictionary> NameDictionary::New(IsolateT* isolate,
       BaseNameDictionary<NameDictionary, NameDictionaryShape>::New(
           isolate, at_least_space_for, allocation, capacity_option);
   dict->set_flags(kFlagsDefault);
+  dict->set_enum_keys_cache(ReadOnlyRoots(isolate).undefined_value());
   return dict;
 }
 
@@ -5480,6 +5481,10 @@ int BaseNameDictionary<Derived, Shape>::NextEnumerationIndex(
     }
 
     index = PropertyDetails::kInitialIndex + length;
+    if constexpr (std::is_same_v<Derived, NameDictionary>) {
+      // The new indices could make the cache look valid again.
+      dictionary->ClearEnumKeysCache();
+    }
   }
 
   // Don't update the next enumeration index here, since we might be looking at
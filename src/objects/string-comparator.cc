@@ -4,6 +4,8 @@
 
 #include "src/objects/string-comparator.h"
 
+#include <algorithm>
+
 #include "src/objects/string-inl.h"
 
 namespace v8 {
@@ -79,5 +81,47 @@ bool StringComparator::Equals(
   }
 }
 
+ComparisonResult StringComparator::Compare(
+    Tagged<String> string_1, Tagged<String> string_2,
+    const SharedStringAccessGuardIfNeeded& access_guard) {
+  DCHECK_LT(0, string_1->length());
+  DCHECK_LT(0, string_2->length());
+  // The result if one string is a prefix of the other.
+  ComparisonResult result = ComparisonResult::kEqual;
+  int length = string_1->length();
+  if (string_2->length() < length) {
+    length = string_2->length();
+    result = ComparisonResult::kGreaterThan;
+  } else if (string_2->length() > length) {
+    result = ComparisonResult::kLessThan;
+  }
+  state_1_.Init(string_1, access_guard);
+  state_2_.Init(string_2, access_guard);
+  while (true) {
+    int to_check = std::min({state_1_.length_, state_2_.length_, length});
+    DCHECK(to_check > 0 && to_check <= length);
+    int r;
+    if (state_1_.is_one_byte_) {
+      if (state_2_.is_one_byte_) {
+        r = Compare<uint8_t, uint8_t>(&state_1_, &state_2_, to_check);
+      } else {
+        r = Compare<uint8_t, uint16_t>(&state_1_, &state_2_, to_check);
+      }
+    } else {
+      if (state_2_.is_one_byte_) {
+        r = Compare<uint16_t, uint8_t>(&state_1_, &state_2_, to_check);
+      } else {
+        r = Compare<uint16_t, uint16_t>(&state_1_, &state_2_, to_check);
+      }
+    }
+    if (r < 0) return ComparisonResult::kLessThan;
+    if (r > 0) return ComparisonResult::kGreaterThan;
+    length -= to_check;
+    if (length == 0) return result;
+    state_1_.Advance(to_check, access_guard);
+    state_2_.Advance(to_check, access_guard);
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
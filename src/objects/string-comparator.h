@@ -7,6 +7,7 @@
 
 #include "src/base/logging.h"
 #include "src/common/globals.h"
+#include "src/objects/objects.h"
 #include "src/objects/string.h"
 #include "src/utils/utils.h"
 
@@ -59,9 +60,21 @@ class StringComparator {
     return CompareCharsEqual(a, b, to_check);
   }
 
+  template <typename Chars1, typename Chars2>
+  static inline int Compare(State* state_1, State* state_2, int to_check) {
+    const Chars1* a = reinterpret_cast<const Chars1*>(state_1->buffer8_);
+    const Chars2* b = reinterpret_cast<const Chars2*>(state_2->buffer8_);
+    return CompareChars(a, b, to_check);
+  }
+
   bool Equals(Tagged<String> string_1, Tagged<String> string_2,
               const SharedStringAccessGuardIfNeeded& access_guard);
 
+  // Orders two non-empty strings like String::Compare, visiting the segments
+  // of cons strings instead of flattening them.
+  ComparisonResult Compare(Tagged<String> string_1, Tagged<String> string_2,
+                           const SharedStringAccessGuardIfNeeded& access_guard);
+
  private:
   State state_1_;
   State state_2_;
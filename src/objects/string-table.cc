@@ -492,6 +492,81 @@ template Handle<String> StringTable::LookupKey(Isolate* isolate,
 template Handle<String> StringTable::LookupKey(LocalIsolate* isolate,
                                                StringTableInsertionKey* key);
 
+template <typename StringTableKey, typename IsolateT>
+void StringTable::LookupKeys(IsolateT* isolate,
+                             base::Vector<StringTableKey> keys,
+                             base::Vector<Handle<String>> results) {
+  DCHECK_EQ(keys.size(), results.size());
+
+  // See LookupKey for why the lookups can be done without holding the lock.
+  // The table data may be freed by a GC, so all lookups happen before the
+  // strings for the misses are allocated.
+  int misses = 0;
+  {
+    DisallowGarbageCollection no_gc;
+    Data* const current_data = data_.load(std::memory_order_acquire);
+    OffHeapStringHashSet& current_table = current_data->table();
+    for (size_t i = 0; i < keys.size(); i++) {
+      StringTableKey* key = &keys[i];
+      InternalIndex entry = current_table.FindEntry(isolate, key, key->hash());
+      if (entry.is_found()) {
+        results[i] = handle(String::cast(current_table.GetKey(isolate, entry)),
+                            isolate);
+      } else {
+        results[i] = Handle<String>();
+        misses++;
+      }
+    }
+  }
+  if (misses == 0) return;
+
+  for (size_t i = 0; i < keys.size(); i++) {
+    if (results[i].is_null()) keys[i].PrepareForInsertion(isolate);
+  }
+
+  base::MutexGuard table_write_guard(&write_mutex_);
+
+  Data* data = EnsureCapacity(isolate, misses);
+  OffHeapStringHashSet& table = data->table();
+
+  for (size_t i = 0; i < keys.size(); i++) {
+    if (!results[i].is_null()) continue;
+    // Check again in case the key was added after the first lookup, possibly
+    // by an earlier key in the same batch.
+    StringTableKey* key = &keys[i];
+    InternalIndex entry =
+        table.FindEntryOrInsertionEntry(isolate, key, key->hash());
+
+    Tagged<Object> element = table.GetKey(isolate, entry);
+    if (element == OffHeapStringHashSet::empty_element()) {
+      Handle<String> new_string = key->GetHandleForInsertion();
+      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
+      table.AddAt(isolate, entry, *new_string);
+      results[i] = new_string;
+    } else if (element == OffHeapStringHashSet::deleted_element()) {
+      Handle<String> new_string = key->GetHandleForInsertion();
+      DCHECK_IMPLIES(v8_flags.shared_string_table, new_string->IsShared());
+      table.OverwriteDeletedAt(isolate, entry, *new_string);
+      results[i] = new_string;
+    } else {
+      results[i] = handle(String::cast(element), isolate);
+    }
+  }
+}
+
+template void StringTable::LookupKeys(Isolate* isolate,
+                                      base::Vector<OneByteStringKey> keys,
+                                      base::Vector<Handle<String>> results);
+template void StringTable::LookupKeys(Isolate* isolate,
+                                      base::Vector<TwoByteStringKey> keys,
+                                      base::Vector<Handle<String>> results);
+template void StringTable::LookupKeys(LocalIsolate* isolate,
+                                      base::Vector<OneByteStringKey> keys,
+                                      base::Vector<Handle<String>> results);
+template void StringTable::LookupKeys(LocalIsolate* isolate,
+                                      base::Vector<TwoByteStringKey> keys,
+                                      base::Vector<Handle<String>> results);
+
 StringTable::Data* StringTable::EnsureCapacity(PtrComprCageBase cage_base,
                                                int additional_elements) {
   // This call is only allowed while the write mutex is held.
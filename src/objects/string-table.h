@@ -66,6 +66,14 @@ class V8_EXPORT_PRIVATE StringTable {
   template <typename StringTableKey, typename IsolateT>
   Handle<String> LookupKey(IsolateT* isolate, StringTableKey* key);
 
+  // Like LookupKey, but for many keys at once: all keys are looked up before
+  // any new string is allocated, and all misses are inserted while holding
+  // the write lock once. The string found for keys[i] is stored in
+  // results[i].
+  template <typename StringTableKey, typename IsolateT>
+  void LookupKeys(IsolateT* isolate, base::Vector<StringTableKey> keys,
+                  base::Vector<Handle<String>> results);
+
   // {raw_string} must be a tagged String pointer.
   // Returns a tagged pointer: either a Smi if the string is an array index, an
   // internalized string, or a Smi sentinel.
@@ -7,6 +7,7 @@
 #include "src/base/small-vector.h"
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
+#include "src/execution/frames.h"
 #include "src/execution/isolate-utils.h"
 #include "src/execution/thread-id.h"
 #include "src/handles/handles-inl.h"
@@ -15,6 +16,7 @@
 #include "src/heap/local-heap-inl.h"
 #include "src/heap/mutable-page.h"
 #include "src/heap/read-only-heap.h"
+#include "src/logging/counters.h"
 #include "src/numbers/conversions.h"
 #include "src/objects/instance-type.h"
 #include "src/objects/map.h"
@@ -96,6 +98,13 @@ Handle<String> String::SlowFlatten(Isolate* isolate, Handle<ConsString> cons,
     raw_cons->set_first(*result);
     raw_cons->set_second(ReadOnlyRoots(isolate).empty_string());
   }
+  isolate->counters()->string_flatten_count()->Increment();
+  isolate->counters()->string_flatten_chars()->Increment(length);
+  if (V8_UNLIKELY(v8_flags.trace_string_flatten)) {
+    PrintF("[flattening cons string of length %d in ", length);
+    JavaScriptFrame::PrintTop(isolate, stdout, false, true);
+    PrintF("]\n");
+  }
   DCHECK(result->IsFlat());
   return result;
 }
@@ -1229,6 +1238,19 @@ ComparisonResult String::Compare(Isolate* isolate, Handle<String> x,
     return ComparisonResult::kGreaterThan;
   }
 
+  // Long cons strings are compared segment by segment. Flattening them would
+  // copy both strings in full, even if they differ early on.
+  auto should_iterate = [](Tagged<String> string) {
+    return IsConsString(string) && !string->IsFlat() &&
+           string->length() >= v8_flags.min_cons_length_to_iterate;
+  };
+  if (should_iterate(*x) || should_iterate(*y)) {
+    DisallowGarbageCollection no_gc;
+    StringComparator comparator;
+    return comparator.Compare(*x, *y,
+                              SharedStringAccessGuardIfNeeded(isolate));
+  }
+
   // Slow case.
   x = String::Flatten(isolate, x);
   y = String::Flatten(isolate, y);
@@ -8,6 +8,8 @@
 #include "src/common/assert-scope.h"
 #include "src/common/globals.h"
 #include "src/common/message-template.h"
+#include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
+#include "src/deoptimizer/deopt-history.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/frames-inl.h"
@@ -371,6 +373,12 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
   JavaScriptFrame* top_frame = top_it.frame();
   isolate->set_context(Context::cast(top_frame->context()));
 
+  // The deopt reset the tiering state of the function, so a Turbofan job that
+  // is still queued for it would produce code that nobody waits for.
+  if (isolate->concurrent_recompilation_enabled()) {
+    isolate->optimizing_compile_dispatcher()->DropStaleJobs();
+  }
+
   // Lazy deopts don't invalidate the underlying optimized code since the code
   // object itself is still valid (as far as we know); the called function
   // caused the deopt, not the function we're currently looking at.
@@ -384,6 +392,16 @@ RUNTIME_FUNCTION(Runtime_NotifyDeoptimized) {
     return ReadOnlyRoots(isolate).undefined_value();
   }
 
+  // Record the failed speculation against the innermost frame, i.e. the
+  // function and bytecode it was made for, even if that function was inlined.
+  if (top_frame->is_unoptimized()) {
+    UnoptimizedFrame* unoptimized_frame = UnoptimizedFrame::cast(top_frame);
+    Handle<JSFunction> deopt_function(unoptimized_frame->function(), isolate);
+    BytecodeOffset deopt_offset(unoptimized_frame->GetBytecodeOffset());
+    isolate->deopt_history()->RecordDeopt(deopt_function, deopt_offset,
+                                          deopt_reason);
+  }
+
   // Non-OSR'd code is deoptimized unconditionally. If the deoptimization occurs
   // inside the outermost loop containning a loop that can trigger OSR
   // compilation, we remove the OSR code, it will avoid hit the out of date OSR
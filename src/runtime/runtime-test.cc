@@ -17,6 +17,7 @@
 #include "src/compiler-dispatcher/lazy-compile-dispatcher.h"
 #include "src/compiler-dispatcher/optimizing-compile-dispatcher.h"
 #include "src/debug/debug-evaluate.h"
+#include "src/deoptimizer/deopt-history.h"
 #include "src/deoptimizer/deoptimizer.h"
 #include "src/execution/arguments-inl.h"
 #include "src/execution/frames-inl.h"
@@ -975,6 +976,41 @@ RUNTIME_FUNCTION(Runtime_GetOptimizationStatus) {
   return Smi::FromInt(status);
 }
 
+// Returns the deopt sites recorded for a function, as an array of
+// {offset, reason, count, speculationDisabled} objects.
+RUNTIME_FUNCTION(Runtime_GetDeoptHistory) {
+  HandleScope scope(isolate);
+  if (args.length() != 1 || !IsJSFunction(args[0])) {
+    return CrashUnlessFuzzing(isolate);
+  }
+  Handle<JSFunction> function = args.at<JSFunction>(0);
+  Factory* factory = isolate->factory();
+
+  const DeoptHistory::Entry* entry =
+      isolate->deopt_history()->Get(function->shared());
+  int length = entry == nullptr ? 0 : static_cast<int>(entry->sites.size());
+  Handle<FixedArray> sites = factory->NewFixedArray(length);
+  for (int i = 0; i < length; i++) {
+    const DeoptHistory::Site& site = entry->sites[i];
+    Handle<JSObject> site_object =
+        factory->NewJSObject(isolate->object_function());
+    JSObject::AddProperty(isolate, site_object, "offset",
+                          handle(Smi::FromInt(site.bytecode_offset), isolate),
+                          NONE);
+    JSObject::AddProperty(
+        isolate, site_object, "reason",
+        factory->NewStringFromAsciiChecked(
+            DeoptimizeReasonToString(site.reason)),
+        NONE);
+    JSObject::AddProperty(isolate, site_object, "count",
+                          handle(Smi::FromInt(site.count), isolate), NONE);
+    JSObject::AddProperty(isolate, site_object, "speculationDisabled",
+                          factory->ToBoolean(site.speculation_disabled), NONE);
+    sites->set(i, *site_object);
+  }
+  return *factory->NewJSArrayWithElements(sites);
+}
+
 RUNTIME_FUNCTION(Runtime_GetFunctionForCurrentFrame) {
   HandleScope scope(isolate);
   DCHECK_EQ(args.length(), 0);
@@ -2065,6 +2101,15 @@ RUNTIME_FUNCTION(Runtime_IsInternalizedString) {
   return isolate->heap()->ToBoolean(IsInternalizedString(*obj));
 }
 
+RUNTIME_FUNCTION(Runtime_IsFlatString) {
+  HandleScope scope(isolate);
+  if (args.length() != 1 || !IsString(args[0])) {
+    return CrashUnlessFuzzing(isolate);
+  }
+  Handle<String> string = args.at<String>(0);
+  return isolate->heap()->ToBoolean(string->IsFlat());
+}
+
 RUNTIME_FUNCTION(Runtime_SharedGC) {
   SealHandleScope scope(isolate);
   isolate->heap()->CollectGarbageShared(isolate->main_thread_local_heap(),
@@ -529,6 +529,7 @@ namespace internal {
   F(FinalizeOptimization, 0, 1)               \
   F(ForceFlush, 1, 1)                         \
   F(GetCallable, 0, 1)                        \
+  F(GetDeoptHistory, 1, 1)                    \
   F(GetFunctionForCurrentFrame, 0, 1)         \
   F(GetInitializerFunction, 1, 1)             \
   F(GetOptimizationStatus, 1, 1)              \
@@ -571,6 +572,7 @@ namespace internal {
   F(IsConcurrentRecompilationSupported, 0, 1) \
   F(IsDictPropertyConstTrackingEnabled, 0, 1) \
   F(IsEfficiencyModeEnabled, 0, 1)            \
+  F(IsFlatString, 1, 1)                       \
   F(IsInPlaceInternalizableString, 1, 1)      \
   F(IsInternalizedString, 1, 1)               \
   F(IsMaglevEnabled, 0, 1)                    \
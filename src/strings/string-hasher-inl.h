@@ -10,6 +10,7 @@
 // Comment inserted to prevent header reordering.
 #include <type_traits>
 
+#include "src/base/bits.h"
 #include "src/objects/name-inl.h"
 #include "src/objects/string-inl.h"
 #include "src/strings/char-predicates-inl.h"
@@ -36,6 +37,13 @@ uint32_t StringHasher::GetHashCore(uint32_t running_hash) {
   return running_hash;
 }
 
+#ifdef V8_USE_BLOCK_STRING_HASH
+uint64_t StringHasher::AddBlockCore(uint64_t running_hash, uint64_t block) {
+  constexpr uint64_t kMultiplier = uint64_t{0x9E3779B97F4A7C15};
+  return (base::bits::RotateLeft64(running_hash, 23) ^ block) * kMultiplier;
+}
+#endif  // V8_USE_BLOCK_STRING_HASH
+
 uint32_t StringHasher::GetTrivialHash(int length) {
   DCHECK_GT(length, String::kMaxHashCalcLength);
   // The hash of a large string is simply computed from the length.
@@ -46,6 +54,46 @@ uint32_t StringHasher::GetTrivialHash(int length) {
   return String::CreateHashFieldValue(hash, String::HashFieldType::kHash);
 }
 
+template <typename uchar>
+uint32_t StringHasher::HashCharacters(const uchar* chars, int length,
+                                      uint64_t seed) {
+  static_assert(std::is_unsigned<uchar>::value);
+#ifdef V8_USE_BLOCK_STRING_HASH
+  // Each block holds four characters as 16-bit lanes, so that one-byte
+  // strings hash the same as two-byte strings with the same contents. For
+  // two-byte strings, this folds into a single load on little-endian hosts.
+  auto char_at = [chars](int i) { return static_cast<uint64_t>(chars[i]); };
+  constexpr uint64_t kMultiplier = uint64_t{0x9E3779B97F4A7C15};
+  uint64_t running_hash = seed ^ (static_cast<uint64_t>(length) * kMultiplier);
+  int i = 0;
+  for (; i + 4 <= length; i += 4) {
+    uint64_t block = char_at(i) | (char_at(i + 1) << 16) |
+                     (char_at(i + 2) << 32) | (char_at(i + 3) << 48);
+    running_hash = AddBlockCore(running_hash, block);
+  }
+  if (i < length) {
+    // The length is part of the initial state, so zero padding is fine.
+    uint64_t block = 0;
+    for (int shift = 0; i < length; i++, shift += 16) {
+      block |= char_at(i) << shift;
+    }
+    running_hash = AddBlockCore(running_hash, block);
+  }
+  // Mix the high bits into the low bits before truncating.
+  running_hash ^= running_hash >> 29;
+  running_hash *= kMultiplier;
+  running_hash ^= running_hash >> 32;
+  return GetHashCore(static_cast<uint32_t>(running_hash));
+#else
+  uint32_t running_hash = static_cast<uint32_t>(seed);
+  const uchar* end = &chars[length];
+  while (chars != end) {
+    running_hash = AddCharacterCore(running_hash, *chars++);
+  }
+  return GetHashCore(running_hash);
+#endif  // V8_USE_BLOCK_STRING_HASH
+}
+
 template <typename char_t>
 uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
                                             uint64_t seed) {
@@ -80,18 +128,15 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
         // Perform a regular hash computation, and additionally check
         // if there are non-digit characters.
         String::HashFieldType type = String::HashFieldType::kIntegerIndex;
-        uint32_t running_hash = static_cast<uint32_t>(seed);
         uint64_t index_big = 0;
-        const uchar* end = &chars[length];
-        while (chars != end) {
-          if (type == String::HashFieldType::kIntegerIndex &&
-              !TryAddIntegerIndexChar(&index_big, *chars)) {
+        for (int i = 0; i < length; i++) {
+          if (!TryAddIntegerIndexChar(&index_big, chars[i])) {
             type = String::HashFieldType::kHash;
+            break;
           }
-          running_hash = AddCharacterCore(running_hash, *chars++);
         }
-        uint32_t hash =
-            String::CreateHashFieldValue(GetHashCore(running_hash), type);
+        uint32_t hash = String::CreateHashFieldValue(
+            HashCharacters(chars, length, seed), type);
         if (Name::ContainsCachedArrayIndex(hash)) {
           // The hash accidentally looks like a cached index. Fix that by
           // setting a bit that looks like a longer-than-cacheable string
@@ -112,13 +157,7 @@ uint32_t StringHasher::HashSequentialString(const char_t* chars_raw, int length,
   }
 
   // Non-index hash.
-  uint32_t running_hash = static_cast<uint32_t>(seed);
-  const uchar* end = &chars[length];
-  while (chars != end) {
-    running_hash = AddCharacterCore(running_hash, *chars++);
-  }
-
-  return String::CreateHashFieldValue(GetHashCore(running_hash),
+  return String::CreateHashFieldValue(HashCharacters(chars, length, seed),
                                       String::HashFieldType::kHash);
 }
 
@@ -38,8 +38,20 @@ class V8_EXPORT_PRIVATE StringHasher final {
   // Reusable parts of the hashing algorithm.
   V8_INLINE static uint32_t AddCharacterCore(uint32_t running_hash, uint16_t c);
   V8_INLINE static uint32_t GetHashCore(uint32_t running_hash);
+#ifdef V8_USE_BLOCK_STRING_HASH
+  V8_INLINE static uint64_t AddBlockCore(uint64_t running_hash, uint64_t block);
+#endif
 
   static inline uint32_t GetTrivialHash(int length);
+
+ private:
+  // Hashes {length} characters, without the index and trivial hash special
+  // cases. By default this adds one character at a time; builds with
+  // v8_use_block_string_hash add four characters at a time instead. The
+  // result only depends on the character values, not on their width.
+  template <typename uchar>
+  static inline uint32_t HashCharacters(const uchar* chars, int length,
+                                        uint64_t seed);
 };
 
 // Useful for std containers that require something ()'able.
@@ -0,0 +1,267 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/strings/string-search-simd.h"
+
+#include "src/base/bits.h"
+#include "src/codegen/cpu-features.h"
+
+#ifdef _MSC_VER
+// MSVC doesn't define SSE3. However, it does define AVX, and AVX implies SSE3.
+#ifdef __AVX__
+#ifndef __SSE3__
+#define __SSE3__
+#endif
+#endif
+#endif
+
+#ifdef __SSE3__
+#include <immintrin.h>
+#endif
+
+#ifdef V8_HOST_ARCH_ARM64
+// As in src/objects/simd.cc, Neon is only used on 64-bit ARM.
+#define NEON64
+#include <arm_neon.h>
+#endif
+
+// The AVX2 code is generated without -mavx2 and only called if the CPU
+// supports it, see src/objects/simd.cc.
+#if defined(__SSE3__) && !defined(_M_IX86) &&           \
+    !(defined(_MSC_VER) && defined(__clang__)) &&       \
+    (defined(V8_TARGET_ARCH_IA32) || defined(V8_TARGET_ARCH_X64))
+#define STRING_SEARCH_SIMD_AVX2
+#ifdef _MSC_VER
+#define TARGET_AVX2
+#else
+#define TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+template <typename Char>
+const Char* FindCharacterPairScalar(const Char* start, const Char* end,
+                                    Char first, Char last, int distance) {
+  for (; start < end; ++start) {
+    if (start[0] == first && start[distance] == last) break;
+  }
+  return start;
+}
+
+const uint16_t* FindCharacterScalar(const uint16_t* start, const uint16_t* end,
+                                    uint16_t c) {
+  for (; start < end; ++start) {
+    if (*start == c) break;
+  }
+  return start;
+}
+
+#ifdef __SSE3__
+// Only SSE2 instructions are used below.
+
+const uint8_t* FindCharacterPairSSE(const uint8_t* start, const uint8_t* end,
+                                    uint8_t first, uint8_t last,
+                                    int distance) {
+  const __m128i first_chars = _mm_set1_epi8(first);
+  const __m128i last_chars = _mm_set1_epi8(last);
+  for (; end - start >= 16; start += 16) {
+    __m128i block_first =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+    __m128i block_last =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(start + distance));
+    __m128i matches = _mm_and_si128(_mm_cmpeq_epi8(block_first, first_chars),
+                                    _mm_cmpeq_epi8(block_last, last_chars));
+    uint32_t mask = _mm_movemask_epi8(matches);
+    if (mask != 0) return start + base::bits::CountTrailingZeros32(mask);
+  }
+  return FindCharacterPairScalar(start, end, first, last, distance);
+}
+
+const uint16_t* FindCharacterPairSSE(const uint16_t* start,
+                                     const uint16_t* end, uint16_t first,
+                                     uint16_t last, int distance) {
+  const __m128i first_chars = _mm_set1_epi16(first);
+  const __m128i last_chars = _mm_set1_epi16(last);
+  for (; end - start >= 8; start += 8) {
+    __m128i block_first =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+    __m128i block_last =
+        _mm_loadu_si128(reinterpret_cast<const __m128i*>(start + distance));
+    __m128i matches = _mm_and_si128(_mm_cmpeq_epi16(block_first, first_chars),
+                                    _mm_cmpeq_epi16(block_last, last_chars));
+    // Two mask bits per character.
+    uint32_t mask = _mm_movemask_epi8(matches);
+    if (mask != 0) return start + base::bits::CountTrailingZeros32(mask) / 2;
+  }
+  return FindCharacterPairScalar(start, end, first, last, distance);
+}
+
+const uint16_t* FindCharacterSSE(const uint16_t* start, const uint16_t* end,
+                                 uint16_t c) {
+  const __m128i chars = _mm_set1_epi16(c);
+  for (; end - start >= 8; start += 8) {
+    __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i*>(start));
+    // Two mask bits per character.
+    uint32_t mask = _mm_movemask_epi8(_mm_cmpeq_epi16(block, chars));
+    if (mask != 0) return start + base::bits::CountTrailingZeros32(mask) / 2;
+  }
+  return FindCharacterScalar(start, end, c);
+}
+#endif  // __SSE3__
+
+#ifdef STRING_SEARCH_SIMD_AVX2
+TARGET_AVX2 const uint8_t* FindCharacterPairAVX2(const uint8_t* start,
+                                                 const uint8_t* end,
+                                                 uint8_t first, uint8_t last,
+                                                 int distance) {
+  const __m256i first_chars = _mm256_set1_epi8(first);
+  const __m256i last_chars = _mm256_set1_epi8(last);
+  for (; end - start >= 32; start += 32) {
+    __m256i block_first =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(start));
+    __m256i block_last =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(start + distance));
+    __m256i matches =
+        _mm256_and_si256(_mm256_cmpeq_epi8(block_first, first_chars),
+                         _mm256_cmpeq_epi8(block_last, last_chars));
+    uint32_t mask = _mm256_movemask_epi8(matches);
+    if (mask != 0) return start + base::bits::CountTrailingZeros32(mask);
+  }
+  return FindCharacterPairSSE(start, end, first, last, distance);
+}
+
+TARGET_AVX2 const uint16_t* FindCharacterPairAVX2(const uint16_t* start,
+                                                  const uint16_t* end,
+                                                  uint16_t first,
+                                                  uint16_t last,
+                                                  int distance) {
+  const __m256i first_chars = _mm256_set1_epi16(first);
+  const __m256i last_chars = _mm256_set1_epi16(last);
+  for (; end - start >= 16; start += 16) {
+    __m256i block_first =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(start));
+    __m256i block_last =
+        _mm256_loadu_si256(reinterpret_cast<const __m256i*>(start + distance));
+    __m256i matches =
+        _mm256_and_si256(_mm256_cmpeq_epi16(block_first, first_chars),
+                         _mm256_cmpeq_epi16(block_last, last_chars));
+    // Two mask bits per character.
+    uint32_t mask = _mm256_movemask_epi8(matches);
+    if (mask != 0) return start + base::bits::CountTrailingZeros32(mask) / 2;
+  }
+  return FindCharacterPairSSE(start, end, first, last, distance);
+}
+#endif  // STRING_SEARCH_SIMD_AVX2
+
+#ifdef NEON64
+// Returns a mask with 4 bits per byte of {matches}.
+inline uint64_t NeonByteMask(uint8x16_t matches) {
+  return vget_lane_u64(
+      vreinterpret_u64_u8(vshrn_n_u16(vreinterpretq_u16_u8(matches), 4)), 0);
+}
+
+// Returns a mask with 8 bits per lane of {matches}.
+inline uint64_t NeonHalfwordMask(uint16x8_t matches) {
+  return vget_lane_u64(vreinterpret_u64_u8(vmovn_u16(matches)), 0);
+}
+
+const uint8_t* FindCharacterPairNeon(const uint8_t* start, const uint8_t* end,
+                                     uint8_t first, uint8_t last,
+                                     int distance) {
+  const uint8x16_t first_chars = vdupq_n_u8(first);
+  const uint8x16_t last_chars = vdupq_n_u8(last);
+  for (; end - start >= 16; start += 16) {
+    uint8x16_t matches =
+        vandq_u8(vceqq_u8(vld1q_u8(start), first_chars),
+                 vceqq_u8(vld1q_u8(start + distance), last_chars));
+    uint64_t mask = NeonByteMask(matches);
+    if (mask != 0) return start + base::bits::CountTrailingZeros64(mask) / 4;
+  }
+  return FindCharacterPairScalar(start, end, first, last, distance);
+}
+
+const uint16_t* FindCharacterPairNeon(const uint16_t* start,
+                                      const uint16_t* end, uint16_t first,
+                                      uint16_t last, int distance) {
+  const uint16x8_t first_chars = vdupq_n_u16(first);
+  const uint16x8_t last_chars = vdupq_n_u16(last);
+  for (; end - start >= 8; start += 8) {
+    uint16x8_t matches =
+        vandq_u16(vceqq_u16(vld1q_u16(start), first_chars),
+                  vceqq_u16(vld1q_u16(start + distance), last_chars));
+    uint64_t mask = NeonHalfwordMask(matches);
+    if (mask != 0) return start + base::bits::CountTrailingZeros64(mask) / 8;
+  }
+  return FindCharacterPairScalar(start, end, first, last, distance);
+}
+
+const uint16_t* FindCharacterNeon(const uint16_t* start, const uint16_t* end,
+                                  uint16_t c) {
+  const uint16x8_t chars = vdupq_n_u16(c);
+  for (; end - start >= 8; start += 8) {
+    uint64_t mask = NeonHalfwordMask(vceqq_u16(vld1q_u16(start), chars));
+    if (mask != 0) return start + base::bits::CountTrailingZeros64(mask) / 8;
+  }
+  return FindCharacterScalar(start, end, c);
+}
+#endif  // NEON64
+
+}  // namespace
+
+const uint8_t* FindCharacterPair(const uint8_t* start, const uint8_t* end,
+                                 uint8_t first, uint8_t last, int distance) {
+#ifdef STRING_SEARCH_SIMD_AVX2
+  if (CpuFeatures::IsSupported(AVX2)) {
+    return FindCharacterPairAVX2(start, end, first, last, distance);
+  }
+#endif
+#if defined(__SSE3__)
+  return FindCharacterPairSSE(start, end, first, last, distance);
+#elif defined(NEON64)
+  return FindCharacterPairNeon(start, end, first, last, distance);
+#else
+  return FindCharacterPairScalar(start, end, first, last, distance);
+#endif
+}
+
+const uint16_t* FindCharacterPair(const uint16_t* start, const uint16_t* end,
+                                  uint16_t first, uint16_t last,
+                                  int distance) {
+#ifdef STRING_SEARCH_SIMD_AVX2
+  if (CpuFeatures::IsSupported(AVX2)) {
+    return FindCharacterPairAVX2(start, end, first, last, distance);
+  }
+#endif
+#if defined(__SSE3__)
+  return FindCharacterPairSSE(start, end, first, last, distance);
+#elif defined(NEON64)
+  return FindCharacterPairNeon(start, end, first, last, distance);
+#else
+  return FindCharacterPairScalar(start, end, first, last, distance);
+#endif
+}
+
+const uint16_t* FindCharacter(const uint16_t* start, const uint16_t* end,
+                              uint16_t c) {
+#if defined(__SSE3__)
+  return FindCharacterSSE(start, end, c);
+#elif defined(NEON64)
+  return FindCharacterNeon(start, end, c);
+#else
+  return FindCharacterScalar(start, end, c);
+#endif
+}
+
+}  // namespace internal
+}  // namespace v8
+
+#undef STRING_SEARCH_SIMD_AVX2
+#undef TARGET_AVX2
+#ifdef NEON64
+#undef NEON64
+#endif
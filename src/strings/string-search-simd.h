@@ -0,0 +1,32 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#ifndef V8_STRINGS_STRING_SEARCH_SIMD_H_
+#define V8_STRINGS_STRING_SEARCH_SIMD_H_
+
+#include <cstdint>
+
+namespace v8 {
+namespace internal {
+
+// Vectorized candidate filters for StringSearch, with a scalar fallback for
+// platforms without SIMD support and for the tail of the subject.
+
+// Returns the first position {pos} in [start, end) with pos[0] == {first} and
+// pos[distance] == {last}, or {end} if there is none. Reads characters up to
+// end[distance - 1].
+const uint8_t* FindCharacterPair(const uint8_t* start, const uint8_t* end,
+                                 uint8_t first, uint8_t last, int distance);
+const uint16_t* FindCharacterPair(const uint16_t* start, const uint16_t* end,
+                                  uint16_t first, uint16_t last, int distance);
+
+// Returns the first position in [start, end) holding {c}, or {end} if there
+// is none. One-byte subjects use memchr instead.
+const uint16_t* FindCharacter(const uint16_t* start, const uint16_t* end,
+                              uint16_t c);
+
+}  // namespace internal
+}  // namespace v8
+
+#endif  // V8_STRINGS_STRING_SEARCH_SIMD_H_
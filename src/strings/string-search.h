@@ -9,6 +9,7 @@
 #include "src/base/vector.h"
 #include "src/execution/isolate.h"
 #include "src/objects/string.h"
+#include "src/strings/string-search-simd.h"
 
 namespace v8 {
 namespace internal {
@@ -202,30 +203,57 @@ inline int FindFirstCharacter(base::Vector<const PatternChar> pattern,
   const PatternChar pattern_first_char = pattern[0];
   const int max_n = (subject.length() - pattern.length() + 1);
 
-  if (sizeof(SubjectChar) == 2 && pattern_first_char == 0) {
-    // Special-case looking for the 0 char in other than one-byte strings.
-    // memchr mostly fails in this case due to every other byte being 0 in text
-    // that is mostly ascii characters.
-    for (int i = index; i < max_n; ++i) {
-      if (subject[i] == 0) return i;
-    }
+  if constexpr (sizeof(SubjectChar) == 2) {
+    DCHECK_LE(index, max_n);
+    // memchr mostly fails for two-byte subjects, since every other byte is 0
+    // in text that is mostly ascii characters.
+    const SubjectChar* end = subject.begin() + max_n;
+    const SubjectChar* pos =
+        FindCharacter(subject.begin() + index, end,
+                      static_cast<SubjectChar>(pattern_first_char));
+    if (pos == end) return -1;
+    return static_cast<int>(pos - subject.begin());
+  } else {
+    const uint8_t search_byte = GetHighestValueByte(pattern_first_char);
+    const SubjectChar search_char =
+        static_cast<SubjectChar>(pattern_first_char);
+    int pos = index;
+    do {
+      DCHECK_GE(max_n - pos, 0);
+      const SubjectChar* char_pos = reinterpret_cast<const SubjectChar*>(
+          memchr(subject.begin() + pos, search_byte,
+                 (max_n - pos) * sizeof(SubjectChar)));
+      if (char_pos == nullptr) return -1;
+      char_pos = AlignDown(char_pos, sizeof(SubjectChar));
+      pos = static_cast<int>(char_pos - subject.begin());
+      if (subject[pos] == search_char) return pos;
+    } while (++pos < max_n);
+
     return -1;
   }
-  const uint8_t search_byte = GetHighestValueByte(pattern_first_char);
-  const SubjectChar search_char = static_cast<SubjectChar>(pattern_first_char);
-  int pos = index;
-  do {
-    DCHECK_GE(max_n - pos, 0);
-    const SubjectChar* char_pos = reinterpret_cast<const SubjectChar*>(
-        memchr(subject.begin() + pos, search_byte,
-               (max_n - pos) * sizeof(SubjectChar)));
-    if (char_pos == nullptr) return -1;
-    char_pos = AlignDown(char_pos, sizeof(SubjectChar));
-    pos = static_cast<int>(char_pos - subject.begin());
-    if (subject[pos] == search_char) return pos;
-  } while (++pos < max_n);
+}
 
-  return -1;
+// Finds the next position at which both the first and the last character of
+// the pattern match, which rules out most false candidates of
+// FindFirstCharacter at the same cost.
+template <typename PatternChar, typename SubjectChar>
+inline int FindFirstAndLastCharacter(base::Vector<const PatternChar> pattern,
+                                     base::Vector<const SubjectChar> subject,
+                                     int index) {
+  DCHECK_GT(pattern.length(), 1);
+  // The StringSearch constructor ensures that two-byte patterns fit one-byte
+  // subjects.
+  const SubjectChar first_char = static_cast<SubjectChar>(pattern[0]);
+  const SubjectChar last_char =
+      static_cast<SubjectChar>(pattern[pattern.length() - 1]);
+  const SubjectChar* end =
+      subject.begin() + (subject.length() - pattern.length() + 1);
+  DCHECK_LE(subject.begin() + index, end);
+  const SubjectChar* pos =
+      FindCharacterPair(subject.begin() + index, end, first_char, last_char,
+                        pattern.length() - 1);
+  if (pos == end) return -1;
+  return static_cast<int>(pos - subject.begin());
 }
 
 //---------------------------------------------------------------------
@@ -275,16 +303,18 @@ int StringSearch<PatternChar, SubjectChar>::LinearSearch(
   int i = index;
   int n = subject.length() - pattern_length;
   while (i <= n) {
-    i = FindFirstCharacter(pattern, subject, i);
+    i = FindFirstAndLastCharacter(pattern, subject, i);
     if (i == -1) return -1;
     DCHECK_LE(i, n);
-    i++;
+    // The first and last characters match, compare the ones in between.
     // Loop extracted to separate function to allow using return to do
     // a deeper break.
-    if (CharCompare(pattern.begin() + 1, subject.begin() + i,
-                    pattern_length - 1)) {
-      return i - 1;
+    if (pattern_length == 2 || CharCompare(pattern.begin() + 1,
+                                           subject.begin() + i + 1,
+                                           pattern_length - 2)) {
+      return i;
     }
+    i++;
   }
   return -1;
 }
@@ -505,12 +535,12 @@ int StringSearch<PatternChar, SubjectChar>::InitialSearch(
   // algorithm.
   int badness = -10 - (pattern_length << 2);
 
-  // We know our pattern is at least 2 characters, we cache the first so
-  // the common case of the first character not matching is faster.
+  // We know our pattern is at least 2 characters, so candidates are filtered
+  // on both its first and last character before the rest is compared.
   for (int i = index, n = subject.length() - pattern_length; i <= n; i++) {
     badness++;
     if (badness <= 0) {
-      i = FindFirstCharacter(pattern, subject, i);
+      i = FindFirstAndLastCharacter(pattern, subject, i);
       if (i == -1) return -1;
       DCHECK_LE(i, n);
       int j = 1;
@@ -10,6 +10,7 @@
 #include "test/cctest/cctest.h"
 #include "test/cctest/compiler/function-tester.h"
 #include "test/common/code-assembler-tester.h"
+#include "test/common/flag-utils.h"
 
 namespace v8 {
 namespace internal {
@@ -30,7 +31,8 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
     auto name = m.Parameter<Name>(1);
     auto map = m.Parameter<Map>(2);
     TNode<IntPtrT> primary_offset =
-        m.StubCachePrimaryOffsetForTesting(name, map);
+        m.StubCachePrimaryOffsetForTesting(isolate->load_stub_cache(), name,
+                                           map);
     TNode<IntPtrT> result;
     if (table == StubCache::kPrimary) {
       result = primary_offset;
@@ -73,7 +75,8 @@ void TestStubCacheOffsetCalculation(StubCache::Table table) {
 
       int expected_result;
       {
-        int primary_offset = StubCache::PrimaryOffsetForTesting(*name, *map);
+        int primary_offset =
+            isolate->load_stub_cache()->PrimaryOffsetForTesting(*name, *map);
         if (table == StubCache::kPrimary) {
           expected_result = primary_offset;
         } else {
@@ -250,5 +253,37 @@ TEST(TryProbeStubCache) {
   CHECK(queried_existing && queried_non_existing);
 }
 
+TEST(StubCacheAdaptiveSizing) {
+  Isolate* isolate(CcTest::InitIsolateOnce());
+  FlagScope<bool> adaptive_sizing(&v8_flags.stub_cache_adaptive_sizing, true);
+  StubCache stub_cache(isolate);
+  stub_cache.Clear();
+  CHECK_EQ(StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+
+  Factory* factory = isolate->factory();
+  Handle<Name> name = factory->InternalizeUtf8String("name");
+  Handle<JSObject> receiver =
+      factory->NewJSObjectFromMap(Map::Create(isolate, 0));
+  Handle<Code> handler = CreateCodeOfKind(CodeKind::FOR_TESTING);
+
+  DisallowGarbageCollection no_gc;
+
+  // More updates than entries between two clears grow the primary table.
+  for (int i = 0; i <= StubCache::kPrimaryTableSize; i++) {
+    stub_cache.Set(*name, receiver->map(), *handler);
+  }
+  stub_cache.Clear();
+  CHECK_EQ(2 * StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+  CHECK_EQ(kNullAddress, stub_cache.Get(*name, receiver->map()).ptr());
+  stub_cache.Set(*name, receiver->map(), *handler);
+  CHECK_EQ(handler->ptr(), stub_cache.Get(*name, receiver->map()).ptr());
+
+  // An idle table shrinks back, but never below its initial size.
+  stub_cache.Clear();
+  CHECK_EQ(StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+  stub_cache.Clear();
+  CHECK_EQ(StubCache::kPrimaryTableSize, stub_cache.primary_table_size());
+}
+
 }  // namespace internal
 }  // namespace v8
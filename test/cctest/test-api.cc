@@ -79,6 +79,7 @@
 #include "src/utils/utils.h"
 #include "test/cctest/heap/heap-tester.h"
 #include "test/cctest/heap/heap-utils.h"
+#include "test/cctest/jsonstream-helper.h"
 #include "test/common/flag-utils.h"
 #include "test/common/streaming-helper.h"
 
@@ -20947,6 +20948,194 @@ THREADED_TEST(JSONStringifyObjectWithGap) {
   ExpectString("JSON.stringify(obj, null,  '*')", *utf8);
 }
 
+static Local<Value> ParseStreaming(
+    v8::Local<v8::Context> context, const char* json,
+    std::vector<size_t> chunk_lengths,
+    v8::JSON::StreamingParser::Encoding encoding =
+        v8::JSON::StreamingParser::Encoding::kUtf8) {
+  std::unique_ptr<v8::JSON::StreamingParser> parser =
+      v8::JSON::ParseStreaming(context->GetIsolate(), encoding);
+  size_t length = strlen(json);
+  size_t position = 0;
+  for (size_t chunk_length : chunk_lengths) {
+    chunk_length = std::min(chunk_length, length - position);
+    parser->Append(json + position, chunk_length);
+    position += chunk_length;
+  }
+  parser->Append(json + position, length - position);
+  Local<Value> result;
+  if (!parser->Finish(context).ToLocal(&result)) return Local<Value>();
+  return result;
+}
+
+THREADED_TEST(JSONParseStreaming) {
+  LocalContext context;
+  v8::Isolate* isolate = context->GetIsolate();
+  HandleScope scope(isolate);
+  // Contains two, three and four byte UTF-8 sequences.
+  const char* json =
+      "{\"a\": [1, 2.5, \"x\\u0041\"], \"\xC3\xA9\": "
+      "\"\xE2\x82\xAC\xF0\x9F\x98\x80\", \"b\": null}";
+  const char* expected =
+      "{\"a\":[1,2.5,\"xA\"],\"\xC3\xA9\":\"\xE2\x82\xAC\xF0\x9F\x98\x80\","
+      "\"b\":null}";
+  // Split the text at every position, and into single bytes.
+  for (size_t i = 0; i <= strlen(json); i++) {
+    Local<Value> value = ParseStreaming(context.local(), json, {i});
+    Local<String> result =
+        v8::JSON::Stringify(context.local(), value).ToLocalChecked();
+    v8::String::Utf8Value utf8(isolate, result);
+    CHECK_EQ(0, strcmp(expected, *utf8));
+  }
+  Local<Value> value = ParseStreaming(context.local(), json,
+                                      std::vector<size_t>(strlen(json), 1));
+  Local<String> result =
+      v8::JSON::Stringify(context.local(), value).ToLocalChecked();
+  v8::String::Utf8Value utf8(isolate, result);
+  CHECK_EQ(0, strcmp(expected, *utf8));
+
+  // Latin-1 input.
+  value = ParseStreaming(context.local(), "[\"\xE9\"]", {2},
+                         v8::JSON::StreamingParser::Encoding::kOneByte);
+  CHECK(value->IsArray());
+  Local<Value> element =
+      value.As<v8::Array>()->Get(context.local(), 0).ToLocalChecked();
+  CHECK(element->StrictEquals(v8_str("\xC3\xA9")));
+
+  // Invalid and truncated UTF-8 is replaced with U+FFFD.
+  value = ParseStreaming(context.local(), "\"\xFF\xE2\x82\"", {2});
+  CHECK(value->StrictEquals(v8_str("\xEF\xBF\xBD\xEF\xBF\xBD")));
+}
+
+THREADED_TEST(JSONParseStreamingErrors) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  {
+    v8::TryCatch try_catch(context->GetIsolate());
+    CHECK(ParseStreaming(context.local(), "{\"a\": ", {3}).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+  {
+    v8::TryCatch try_catch(context->GetIsolate());
+    CHECK(ParseStreaming(context.local(), "", {}).IsEmpty());
+    CHECK(try_catch.HasCaught());
+  }
+}
+
+static void ExpectStringifyToStream(v8::Local<v8::Context> context,
+                                    const char* object_source,
+                                    v8::Local<String> gap) {
+  Local<Value> value = CompileRun(object_source);
+  Local<String> json =
+      v8::JSON::Stringify(context, value, gap).ToLocalChecked();
+  v8::String::Utf8Value expected(context->GetIsolate(), json);
+
+  v8::internal::TestJSONStream stream;
+  CHECK(v8::JSON::StringifyToStream(context, value, &stream, gap).FromJust());
+  CHECK_EQ(1, stream.eos_signaled());
+  CHECK_EQ(expected.length(), stream.size());
+  v8::base::ScopedVector<char> result(stream.size());
+  stream.WriteTo(result);
+  CHECK_EQ(0, memcmp(*expected, result.begin(), stream.size()));
+}
+
+THREADED_TEST(JSONStringifyToStream) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  ExpectStringifyToStream(context.local(), "({x: 42})", v8_str(""));
+  ExpectStringifyToStream(context.local(), "'\\u00e9\\ud83d\\ude00'",
+                          v8_str(""));
+  ExpectStringifyToStream(context.local(), "undefined", v8_str(""));
+  // Large enough to be written in many chunks, with characters that take up
+  // several bytes in UTF-8 and surrogate pairs on chunk boundaries.
+  const char* large =
+      "(function() {"
+      "  const result = [];"
+      "  for (let i = 0; i < 3000; i++) {"
+      "    result.push({id: i, s: '\\u00e9'.repeat(i % 7) +"
+      "                 '\\ud83d\\ude00'.repeat(i % 5), n: i / 3});"
+      "  }"
+      "  result.push('x\\u0100'.repeat(10000));"
+      "  return result;"
+      "})()";
+  ExpectStringifyToStream(context.local(), large, v8_str(""));
+  ExpectStringifyToStream(context.local(), large, v8_str("\t"));
+}
+
+THREADED_TEST(JSONStringifyToStreamAbort) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  Local<Value> value = CompileRun(
+      "(function() {"
+      "  const result = [];"
+      "  for (let i = 0; i < 3000; i++) result.push({id: i});"
+      "  return result;"
+      "})()");
+  v8::internal::TestJSONStream stream(2);
+  CHECK(!v8::JSON::StringifyToStream(context.local(), value, &stream)
+             .FromJust());
+  CHECK_EQ(0, stream.eos_signaled());
+  CHECK_LE(stream.size(), 1024);
+}
+
+// Records the largest chunk, and triggers GCs from the stream now and then.
+class LargestChunkJSONStream : public v8::internal::TestJSONStream {
+ public:
+  OutputStream::WriteResult WriteAsciiChunk(char* buffer,
+                                            int chars_written) override {
+    largest_chunk_ = std::max(largest_chunk_, chars_written);
+    if (++chunk_count_ % 100 == 0) i::heap::InvokeMajorGC(CcTest::heap());
+    return TestJSONStream::WriteAsciiChunk(buffer, chars_written);
+  }
+  int largest_chunk() const { return largest_chunk_; }
+  int chunk_count() const { return chunk_count_; }
+
+ private:
+  int largest_chunk_ = 0;
+  int chunk_count_ = 0;
+};
+
+// Single large strings are written in chunks of at most the chunk size, also
+// if the stream triggers GCs while a string is being serialized.
+TEST(JSONStringifyToStreamLargeString) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  const char* sources[] = {
+      "'x'.repeat(1000000)",
+      "'a\\n\\u0100\\ud83d\\ude00\\ud800\"'.repeat(100000)",
+      "({['\\u00e9'.repeat(500000)]: '\\u00e9'.repeat(500000)})",
+  };
+  for (const char* source : sources) {
+    Local<Value> value = CompileRun(source);
+    Local<String> json =
+        v8::JSON::Stringify(context.local(), value).ToLocalChecked();
+    v8::String::Utf8Value expected(context->GetIsolate(), json);
+
+    LargestChunkJSONStream stream;
+    CHECK(v8::JSON::StringifyToStream(context.local(), value, &stream)
+              .FromJust());
+    CHECK_EQ(1, stream.eos_signaled());
+    CHECK_LE(stream.largest_chunk(), stream.GetChunkSize());
+    CHECK_GE(stream.chunk_count(), expected.length() / stream.GetChunkSize());
+    CHECK_EQ(expected.length(), stream.size());
+    v8::base::ScopedVector<char> result(stream.size());
+    stream.WriteTo(result);
+    CHECK_EQ(0, memcmp(*expected, result.begin(), stream.size()));
+  }
+}
+
+THREADED_TEST(JSONStringifyToStreamException) {
+  LocalContext context;
+  HandleScope scope(context->GetIsolate());
+  Local<Value> value = CompileRun("({toJSON() { throw 42; }})");
+  v8::TryCatch try_catch(context->GetIsolate());
+  v8::internal::TestJSONStream stream;
+  CHECK(v8::JSON::StringifyToStream(context.local(), value, &stream)
+            .IsNothing());
+  CHECK(try_catch.HasCaught());
+  CHECK_EQ(0, stream.eos_signaled());
+}
+
 #if V8_OS_POSIX
 class ThreadInterruptTest {
  public:
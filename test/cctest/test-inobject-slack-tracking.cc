@@ -1469,6 +1469,59 @@ TEST(InstanceFieldsArePropertiesFieldsAndConstructorEager) {
   CHECK_EQ(21 + 8, obj->map()->GetInObjectProperties());
 }
 
+TEST(LearnShapesFromOutOfObjectProperties) {
+  // Avoid eventual completion of in-object slack tracking.
+  v8_flags.always_turbofan = false;
+  v8_flags.slack_tracking_learn_shapes = true;
+  CcTest::InitializeVM();
+  v8::HandleScope scope(CcTest::isolate());
+  CompileRun(
+      "function factory() {\n"
+      "  return function A() { this.a = 1; };\n"
+      "}\n"
+      "var A1 = factory();\n"
+      "var A2 = factory();\n"
+      "function make(A, reverse) {\n"
+      "  var o = new A();\n"
+      "  if (reverse) { o.y = 1; o.x = 2; } else { o.x = 1; o.y = 2; }\n"
+      "  for (var i = 0; i < 10; i++) o['p' + i] = i;\n"
+      "  return o;\n"
+      "}\n");
+
+  Handle<JSFunction> a1 = GetGlobal<JSFunction>("A1");
+  Handle<JSFunction> a2 = GetGlobal<JSFunction>("A2");
+  CHECK_EQ(a1->shared(), a2->shared());
+
+  v8::Local<v8::Script> make_a1 = v8_compile("make(A1, false);");
+  v8::Local<v8::Script> make_a1_reversed = v8_compile("make(A1, true);");
+  Handle<JSObject> obj = RunI<JSObject>(make_a1);
+  RunI<JSObject>(make_a1_reversed);
+  Handle<Map> initial_map(a1->initial_map(), a1->GetIsolate());
+  CHECK_EQ(1 + 8, initial_map->GetInObjectProperties());
+  CHECK_EQ(13, obj->map()->NumberOfFields(ConcurrencyMode::kSynchronous));
+
+  Map::TransitionTreeStats stats =
+      initial_map->ComputeTransitionTreeStats(CcTest::i_isolate());
+  CHECK_EQ(13, stats.max_depth);
+  CHECK_EQ(13, stats.max_field_count);
+  // {a, x, y} vs. {a, y, x} and all their descendants.
+  CHECK_EQ(11, stats.reordered_shape_count);
+
+  // Complete the tracking.
+  for (int i = 2; i < Map::kGenerousAllocationCount; i++) {
+    CHECK(initial_map->IsInobjectSlackTrackingInProgress());
+    RunI<JSObject>(make_a1);
+  }
+  CHECK(!initial_map->IsInobjectSlackTrackingInProgress());
+  CHECK_EQ(1 + 8, initial_map->GetInObjectProperties());
+
+  // The other closure learned to expect all 13 fields, and reserves the usual
+  // slack on top of them.
+  obj = RunI<JSObject>(v8_compile("make(A2, false);"));
+  CHECK_EQ(13 + 8, obj->map()->GetInObjectProperties());
+  CHECK_EQ(0, obj->property_array()->length());
+}
+
 }  // namespace test_inobject_slack_tracking
 }  // namespace internal
 }  // namespace v8
@@ -34,3 +34,63 @@ function StringIndexOfNonConstant() {
 
   return sum;
 }
+
+new BenchmarkSuite('StringIndexOfLongOneByte', [5], [
+  new Benchmark('StringIndexOfLongOneByte', true, false, 0,
+  StringIndexOfLongOneByte),
+]);
+
+new BenchmarkSuite('StringIndexOfLongTwoByte', [5], [
+  new Benchmark('StringIndexOfLongTwoByte', true, false, 0,
+  StringIndexOfLongTwoByte),
+]);
+
+new BenchmarkSuite('StringIncludesLong', [5], [
+  new Benchmark('StringIncludesLong', true, false, 0,
+  StringIncludesLong),
+]);
+
+// Log-like text, where the first characters of the patterns are frequent.
+function MakeLog(lines, suffix) {
+  let log = '';
+  for (let i = 0; i < lines; ++i) {
+    log += `2024-01-01T00:00:${i % 60} INFO request ${i} served in ` +
+        `${i % 97}ms from cache${suffix}\n`;
+  }
+  return log;
+}
+
+const longOneByteSubject = MakeLog(200, '') + 'ERROR timeout\n';
+const longTwoByteSubject = MakeLog(200, ' ✓') + 'ERROR timeout\n';
+const longSearches = ['ERROR', 'timeout', 'e', 'request 199 ', 'missing'];
+
+function StringIndexOfLongOneByte() {
+  var sum = 0;
+
+  for (var j = 0; j < longSearches.length; ++j) {
+    sum += longOneByteSubject.indexOf(longSearches[j]);
+  }
+
+  return sum;
+}
+
+function StringIndexOfLongTwoByte() {
+  var sum = 0;
+
+  for (var j = 0; j < longSearches.length; ++j) {
+    sum += longTwoByteSubject.indexOf(longSearches[j]);
+  }
+
+  return sum;
+}
+
+function StringIncludesLong() {
+  var sum = 0;
+
+  for (var j = 0; j < longSearches.length; ++j) {
+    if (longOneByteSubject.includes(longSearches[j])) ++sum;
+    if (longTwoByteSubject.includes(longSearches[j])) ++sum;
+  }
+
+  return sum;
+}
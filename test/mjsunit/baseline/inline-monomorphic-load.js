@@ -0,0 +1,79 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --sparkplug --no-always-sparkplug
+// Flags: --sparkplug-inline-monomorphic-loads --no-baseline-batch-compilation
+// Flags: --no-maglev --no-turbofan
+
+function getX(o) {
+  return o.x;
+}
+
+function Point(x, y) {
+  this.x = x;
+  this.y = y;
+}
+
+// Warm up the load IC on a single map, then compile with that feedback.
+%PrepareFunctionForOptimization(getX);
+getX(new Point(1, 2));
+getX(new Point(3, 4));
+%CompileBaseline(getX);
+assertTrue(isBaseline(getX));
+
+// Same map: the inline field load.
+assertEquals(5, getX(new Point(5, 6)));
+assertEquals(undefined, getX(new Point(undefined, 6)));
+// Other maps, Smis and primitives fall back to the IC.
+assertEquals(7, getX({x: 7}));
+assertEquals(8, getX({y: 0, x: 8}));
+assertEquals(undefined, getX(1));
+assertEquals(undefined, getX('str'));
+assertThrows(() => getX(undefined), TypeError);
+assertEquals(9, getX(new Point(9, 10)));
+
+// Out-of-object properties. The literal only has in-object space for its own
+// property, so the named stores below go to the property array but keep the
+// object in fast mode.
+function getZ(o) {
+  return o.z;
+}
+function withOutOfObjectZ(z) {
+  let o = {a: 0};
+  o.b = 1;
+  o.c = 2;
+  o.d = 3;
+  o.e = 4;
+  o.f = 5;
+  o.z = z;
+  return o;
+}
+assertTrue(%HasFastProperties(withOutOfObjectZ(0)));
+%PrepareFunctionForOptimization(getZ);
+getZ(withOutOfObjectZ(1));
+getZ(withOutOfObjectZ(2));
+%CompileBaseline(getZ);
+assertTrue(isBaseline(getZ));
+assertEquals(3, getZ(withOutOfObjectZ(3)));
+assertEquals('z', getZ(withOutOfObjectZ('z')));
+assertEquals(4, getZ({z: 4}));
+
+// A field that changed afterwards is still read correctly.
+function getA(o) {
+  return o.a;
+}
+function makeA(a) {
+  return {a: a, b: 0};
+}
+%PrepareFunctionForOptimization(getA);
+getA(makeA(1));
+getA(makeA(2));
+%CompileBaseline(getA);
+assertTrue(isBaseline(getA));
+let o = makeA(1);
+o.a = 'string';
+assertEquals('string', getA(o));
+o.a = 1.5;
+assertEquals(1.5, getA(o));
+assertEquals(2.5, getA(makeA(2.5)));
@@ -0,0 +1,47 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --turbo-branch-hints-from-feedback
+
+// Arms of a conditional whose ICs have never run are hinted as unlikely.
+// Hints must only affect code placement, never the result.
+
+function g(x) { return x + 1; }
+function h(x) { return x - 1; }
+
+function f(o, x) {
+  if (x > 0) {
+    return o.a + g(x);
+  } else {
+    return o.b + h(x);
+  }
+}
+
+%PrepareFunctionForOptimization(f);
+assertEquals(3, f({a: 1, b: 2}, 1));
+assertEquals(4, f({a: 2, b: 2}, 1));
+%OptimizeFunctionOnNextCall(f);
+assertEquals(3, f({a: 1, b: 2}, 1));
+// The cold arm still computes the right value.
+assertEquals(1, f({a: 1, b: 2}, 0));
+assertEquals(-1, f({a: 1, b: 2}, -2));
+
+function loop(a) {
+  let s = 0;
+  for (let i = 0; i < a.length; i++) {
+    if (a[i] === undefined) {
+      s += g(i);
+    } else {
+      s += a[i];
+    }
+  }
+  return s;
+}
+
+%PrepareFunctionForOptimization(loop);
+assertEquals(6, loop([1, 2, 3]));
+assertEquals(6, loop([1, 2, 3]));
+%OptimizeFunctionOnNextCall(loop);
+assertEquals(6, loop([1, 2, 3]));
+assertEquals(5, loop([1, , 3]));
@@ -0,0 +1,62 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --no-always-turbofan
+// Flags: --deopt-loop-detection --deopt-loop-threshold=2 --no-maglev
+
+// A property load is used here because the interpreter on its own only takes
+// the load to polymorphic after a wrong map deopt, which optimized code would
+// still check maps for. Only the detected loop takes it to megamorphic.
+function load(o) {
+  return o.x;
+}
+
+const a = {x: 1};
+const b = {y: 0, x: 2};
+const c = {z: 0, x: 3};
+
+%PrepareFunctionForOptimization(load);
+assertEquals([], %GetDeoptHistory(load));
+load(a);
+load(a);
+%OptimizeFunctionOnNextCall(load);
+assertEquals(1, load(a));
+assertOptimized(load);
+
+// The first deopt at the load is recorded, but isn't a loop yet.
+assertEquals(2, load(b));
+assertUnoptimized(load);
+let history = %GetDeoptHistory(load);
+assertEquals(1, history.length);
+assertEquals(1, history[0].count);
+assertFalse(history[0].speculationDisabled);
+
+// Another deopt for the same reason at the same site is treated as a loop.
+// Feed a single map only again, so the load deopts the same way.
+%ClearFunctionFeedback(load);
+%PrepareFunctionForOptimization(load);
+load(a);
+load(a);
+%OptimizeFunctionOnNextCall(load);
+assertEquals(1, load(a));
+assertOptimized(load);
+assertEquals(2, load(b));
+assertUnoptimized(load);
+history = %GetDeoptHistory(load);
+assertEquals(1, history.length);
+assertEquals(2, history[0].count);
+assertTrue(history[0].speculationDisabled);
+
+// The load went megamorphic, so code optimized now doesn't check maps at it
+// and a map it has never seen doesn't deopt it again. Without the detection
+// the load would only know about {a} and {b} here.
+load(a);
+%OptimizeFunctionOnNextCall(load);
+assertEquals(1, load(a));
+assertOptimized(load);
+assertEquals(3, load(c));
+assertOptimized(load);
+history = %GetDeoptHistory(load);
+assertEquals(1, history.length);
+assertEquals(2, history[0].count);
@@ -0,0 +1,93 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --turbofan --no-always-turbofan
+
+const log = [];
+const handler = {
+  get(target, key, receiver) {
+    log.push('get ' + String(key));
+    return Reflect.get(target, key, receiver);
+  },
+  set(target, key, value, receiver) {
+    log.push('set ' + String(key));
+    return Reflect.set(target, key, value, receiver);
+  },
+  has(target, key) {
+    log.push('has ' + String(key));
+    return key in target;
+  },
+};
+
+function load(p) { return p.x; }
+function keyedLoad(p, key) { return p[key]; }
+function store(p, v) { p.x = v; return p.x; }
+function has(p) { return 'x' in p; }
+
+function test(fn, ...args) {
+  %PrepareFunctionForOptimization(fn);
+  const expected = fn(...args);
+  fn(...args);
+  %OptimizeFunctionOnNextCall(fn);
+  assertEquals(expected, fn(...args));
+  assertOptimized(fn);
+}
+
+const target = {x: 1, y: 2};
+const proxy = new Proxy(target, handler);
+
+test(load, proxy);
+test(keyedLoad, proxy, 'y');
+test(store, proxy, 3);
+test(has, proxy);
+assertEquals(3, target.x);
+assertTrue(log.includes('get x'));
+assertTrue(log.includes('get y'));
+assertTrue(log.includes('set x'));
+assertTrue(log.includes('has x'));
+
+// The keyed access checks that the key is still the name from the feedback.
+assertEquals(2, keyedLoad(proxy, 'y'));
+assertOptimized(keyedLoad);
+assertEquals(3, keyedLoad(proxy, 'x'));
+assertUnoptimized(keyedLoad);
+
+// Changing the trap is observed by optimized code.
+handler.get = () => 42;
+assertEquals(42, load(proxy));
+assertOptimized(load);
+delete handler.get;
+assertEquals(3, load(proxy));
+
+// Exceptions thrown by traps propagate to the optimized code.
+function loadCatch(p) {
+  try {
+    return p.x;
+  } catch (e) {
+    return e;
+  }
+}
+const throwing = new Proxy({}, {get() { throw 'trap'; }});
+test(loadCatch, throwing);
+assertEquals('trap', loadCatch(throwing));
+
+// Strict mode stores throw if the trap returns false.
+function strictStore(p) {
+  'use strict';
+  p.x = 1;
+}
+const rejecting = new Proxy({}, {set() { return false; }});
+%PrepareFunctionForOptimization(strictStore);
+assertThrows(() => strictStore(rejecting), TypeError);
+assertThrows(() => strictStore(rejecting), TypeError);
+%OptimizeFunctionOnNextCall(strictStore);
+assertThrows(() => strictStore(rejecting), TypeError);
+
+// Revoked proxies and non-proxy receivers.
+const {proxy: revocable, revoke} = Proxy.revocable({x: 5}, {});
+test(load, revocable);
+revoke();
+assertThrows(() => load(revocable), TypeError);
+assertEquals(6, load({x: 6}));
+assertUnoptimized(load);
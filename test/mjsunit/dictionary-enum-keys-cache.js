@@ -0,0 +1,83 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --dictionary-enum-keys-cache
+
+// The enumerable keys of dictionary-mode objects are cached; every kind of
+// mutation has to be reflected in later enumerations.
+
+function forInKeys(o) {
+  const keys = [];
+  for (const key in o) keys.push(key);
+  return keys;
+}
+
+function check(expected, o) {
+  assertFalse(%HasFastProperties(o));
+  // Enumerate twice to hit the cache.
+  assertEquals(expected, Object.keys(o));
+  assertEquals(expected, Object.keys(o));
+  assertEquals(expected, forInKeys(o));
+  assertEquals(expected, forInKeys(o));
+}
+
+const o = {a: 1, b: 2, c: 3, d: 4};
+delete o.d;
+check(['a', 'b', 'c'], o);
+
+// Add a property.
+o.e = 5;
+check(['a', 'b', 'c', 'e'], o);
+
+// Delete a property.
+delete o.b;
+check(['a', 'c', 'e'], o);
+
+// Delete and add a property, keeping the number of properties.
+delete o.a;
+o.f = 6;
+check(['c', 'e', 'f'], o);
+
+// Re-add a deleted property, which moves it to the end.
+delete o.c;
+o.c = 7;
+check(['e', 'f', 'c'], o);
+
+// Make properties non-enumerable and enumerable again.
+Object.defineProperty(o, 'e', {enumerable: false});
+check(['f', 'c'], o);
+Object.defineProperty(o, 'e', {enumerable: true});
+check(['e', 'f', 'c'], o);
+
+// Changing values or other attributes keeps the keys.
+o.f = 'x';
+Object.defineProperty(o, 'c', {writable: false});
+check(['e', 'f', 'c'], o);
+
+// Symbols and elements don't show up in the cached keys.
+o[Symbol('s')] = 1;
+o[0] = 0;
+assertEquals(['0', 'e', 'f', 'c'], Object.keys(o));
+assertEquals(['0', 'e', 'f', 'c'], Object.keys(o));
+delete o[0];
+check(['e', 'f', 'c'], o);
+
+// Mutating the result doesn't affect later enumerations.
+const keys = Object.keys(o);
+keys[0] = 'mutated';
+keys.push('extra');
+check(['e', 'f', 'c'], o);
+
+// Large dictionaries.
+const big = {};
+for (let i = 0; i < 1000; i++) big['k' + i] = i;
+delete big.k500;
+const expected = [];
+for (let i = 0; i < 1000; i++) {
+  if (i != 500) expected.push('k' + i);
+}
+check(expected, big);
+big.k500 = 500;
+expected.push('k500');
+check(expected, big);
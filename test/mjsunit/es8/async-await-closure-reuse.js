@@ -0,0 +1,45 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// An async function resumes correctly from many awaits in a row, alternating
+// between fulfilled and rejected promises, including when several instances
+// of the same async function are suspended at the same time.
+
+async function run(id, n) {
+  const log = [];
+  for (let i = 0; i < n; i++) {
+    try {
+      if (i % 3 == 0) {
+        await Promise.reject(id + ':' + i);
+      } else {
+        log.push(await (i % 2 ? Promise.resolve(i) : i));
+      }
+    } catch (e) {
+      log.push(e);
+    }
+  }
+  return log;
+}
+
+function expected(id, n) {
+  const log = [];
+  for (let i = 0; i < n; i++) log.push(i % 3 == 0 ? id + ':' + i : i);
+  return log;
+}
+
+function test() {
+  const results = [];
+  run('a', 10).then(log => results.push(log));
+  run('b', 7).then(log => results.push(log));
+  %PerformMicrotaskCheckpoint();
+  assertEquals([expected('b', 7), expected('a', 10)], results);
+}
+
+%PrepareFunctionForOptimization(run);
+test();
+test();
+%OptimizeFunctionOnNextCall(run);
+test();
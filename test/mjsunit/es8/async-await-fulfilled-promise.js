@@ -0,0 +1,47 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax
+
+// Awaiting an already fulfilled promise still takes exactly one microtask
+// tick, interleaved in order with other reactions.
+
+const log = [];
+
+async function awaitFulfilled(name, value) {
+  log.push(name + ':start');
+  const result = await value;
+  log.push(name + ':' + result);
+  return result;
+}
+
+async function awaitRejected(name) {
+  try {
+    await Promise.reject(name + ':rejected');
+  } catch (e) {
+    log.push(e);
+  }
+}
+
+let pendingResolve;
+const pending = new Promise(resolve => pendingResolve = resolve);
+
+awaitFulfilled('a', Promise.resolve(1));
+awaitFulfilled('b', 2);
+awaitRejected('c');
+awaitFulfilled('d', pending);
+Promise.resolve().then(() => log.push('then'));
+pendingResolve(3);
+awaitFulfilled('e', Promise.resolve(4)).then(v => log.push('e:done:' + v));
+
+assertEquals(['a:start', 'b:start', 'd:start', 'e:start'], log);
+
+%PerformMicrotaskCheckpoint();
+
+assertEquals(
+    [
+      'a:start', 'b:start', 'd:start', 'e:start', 'a:1', 'b:2',
+      'c:rejected', 'then', 'd:3', 'e:4', 'e:done:4'
+    ],
+    log);
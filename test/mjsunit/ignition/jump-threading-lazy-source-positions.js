@@ -0,0 +1,43 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --ignition-jump-threading --enable-lazy-source-positions
+// Flags: --stress-lazy-source-positions
+
+// Collecting source positions lazily regenerates the bytecode, which must
+// match the threaded bytecode that is already installed.
+
+function nested(a, b) {
+  let r;
+  if (a) {
+    // The jump over the inner else lands on the jump over the outer else.
+    if (b) {
+      r = 1;
+    } else {
+      r = 2;
+    }
+  } else {
+    r = 3;
+  }
+  return [r, new Error().stack];
+}
+
+function logical(a, b, c) {
+  // The jump taken when {a} is truthy lands on the jump taken when (a || b) is
+  // truthy.
+  let r = (a || b) || c;
+  return [r, new Error().stack];
+}
+
+let [r, stack] = nested(true, true);
+assertEquals(1, r);
+assertTrue(stack.includes('nested'));
+assertEquals(2, nested(true, false)[0]);
+assertEquals(3, nested(false, true)[0]);
+
+[r, stack] = logical(1, 2, 3);
+assertEquals(1, r);
+assertTrue(stack.includes('logical'));
+assertEquals(2, logical(0, 2, 3)[0]);
+assertEquals(3, logical(0, 0, 3)[0]);
@@ -0,0 +1,57 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --json-parse-expected-maps
+
+// Objects with the same keys share a map, also when they are not
+// neighbouring array elements.
+(function TestSharedMaps() {
+  const result = JSON.parse(
+      '{"first": {"x": 1, "y": 2}, "list": [{"x": 3, "y": 4}, {"a": 0},' +
+      ' {"x": 5, "y": 6}], "last": {"x": 7, "y": 8}}');
+  assertEquals({x: 1, y: 2}, result.first);
+  assertEquals({x: 7, y: 8}, result.last);
+  assertTrue(%HaveSameMap(result.first, result.list[0]));
+  assertTrue(%HaveSameMap(result.first, result.list[2]));
+  assertTrue(%HaveSameMap(result.first, result.last));
+  assertFalse(%HaveSameMap(result.first, result.list[1]));
+})();
+
+// Alternating shapes in one array.
+(function TestAlternatingShapes() {
+  const records = [];
+  for (let i = 0; i < 100; i++) {
+    records.push(i % 2 ? {id: i, name: 'n' + i} : {id: i, tags: [i]});
+  }
+  const result = JSON.parse(JSON.stringify(records));
+  assertEquals(records, result);
+  for (let i = 2; i < result.length; i++) {
+    assertTrue(%HaveSameMap(result[i], result[i - 2]));
+  }
+})();
+
+// Keys in a different order, with escapes or with elements get the right
+// properties.
+(function TestDifferentKeys() {
+  const result = JSON.parse(
+      '[{"a": 1, "b": 2}, {"b": 3, "a": 4}, {"\\u0061": 5, "b": 6},' +
+      ' {"a": 7, "b": 8, "0": 9}, {"a": 10}, {"a": 11, "b": 12, "c": 13}]');
+  assertEquals([
+    {a: 1, b: 2}, {b: 3, a: 4}, {a: 5, b: 6}, {a: 7, b: 8, 0: 9}, {a: 10},
+    {a: 11, b: 12, c: 13}
+  ], result);
+  assertEquals(['b', 'a'], Object.keys(result[1]));
+  assertTrue(%HaveSameMap(result[0], result[2]));
+})();
+
+// Field representations are generalized along the way.
+(function TestRepresentations() {
+  const result = JSON.parse(
+      '{"p": {"v": 1}, "q": [{"v": 1.5}], "r": {"v": "s"}, "t": {"v": 2}}');
+  assertEquals(1, result.p.v);
+  assertEquals(1.5, result.q[0].v);
+  assertEquals('s', result.r.v);
+  assertEquals(2, result.t.v);
+  assertTrue(%HaveSameMap(result.r, result.t));
+})();
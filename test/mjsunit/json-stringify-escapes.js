@@ -0,0 +1,58 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Runs of characters that don't need escaping are copied in bulk, both when
+// the escaped string fits into the current output part and when it doesn't.
+
+function expected(s) {
+  let result = '"';
+  for (let i = 0; i < s.length; i++) {
+    const c = s.charCodeAt(i);
+    const next = s.charCodeAt(i + 1);
+    if (c >= 0xD800 && c <= 0xDBFF && next >= 0xDC00 && next <= 0xDFFF) {
+      result += s[i] + s[i + 1];
+      i++;
+    } else if (c == 0x22) {
+      result += '\\"';
+    } else if (c == 0x5C) {
+      result += '\\\\';
+    } else if (c == 0x08) {
+      result += '\\b';
+    } else if (c == 0x09) {
+      result += '\\t';
+    } else if (c == 0x0A) {
+      result += '\\n';
+    } else if (c == 0x0C) {
+      result += '\\f';
+    } else if (c == 0x0D) {
+      result += '\\r';
+    } else if (c < 0x20 || (c >= 0xD800 && c <= 0xDFFF)) {
+      result += '\\u' + c.toString(16).padStart(4, '0');
+    } else {
+      result += s[i];
+    }
+  }
+  return result + '"';
+}
+
+const specials = [
+  '"', '\\', '\n', '\x00', '\x1f', '\x7f', '\xff', 'Ā', '\ud800',
+  '\udc00', '😀', ''
+];
+
+for (const length of [0, 1, 7, 8, 15, 16, 17, 31, 32, 33, 100, 20000]) {
+  const plain = 'abcdefghijklmnopqrstuvwxyz0123456789'.repeat(
+      Math.ceil(length / 36)).substring(0, length);
+  assertEquals(expected(plain), JSON.stringify(plain));
+  for (const special of specials) {
+    for (const position of [0, length >> 1, length]) {
+      const s = plain.substring(0, position) + special +
+          plain.substring(position);
+      assertEquals(expected(s), JSON.stringify(s));
+      assertEquals(expected(s) + ':' + expected(s),
+                   JSON.stringify({[s]: s}).slice(1, -1));
+      assertEquals(s, JSON.parse(JSON.stringify(s)));
+    }
+  }
+}
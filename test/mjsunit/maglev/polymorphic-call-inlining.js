@@ -0,0 +1,70 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --allow-natives-syntax --maglev --maglev-inlining
+// Flags: --maglev-polymorphic-inlining
+
+class Num {
+  constructor(v) { this.v = v; }
+  accept(visitor) { return visitor.visitNum(this); }
+}
+class Add {
+  constructor(l, r) { this.l = l; this.r = r; }
+  accept(visitor) { return visitor.visitAdd(this); }
+}
+class Neg {
+  constructor(e) { this.e = e; }
+  accept(visitor) { return visitor.visitNeg(this); }
+}
+
+const evaluator = {
+  visitNum(n) { return n.v; },
+  visitAdd(n) { return n.l.accept(this) + n.r.accept(this); },
+  visitNeg(n) { return -n.e.accept(this); },
+};
+
+function evaluate(node) {
+  // Polymorphic in the receiver map, and thus in the call target.
+  return node.accept(evaluator);
+}
+
+const nodes = [new Num(3), new Add(new Num(1), new Num(2)),
+               new Neg(new Num(4))];
+
+function run() {
+  let sum = 0;
+  for (let n of nodes) sum += evaluate(n);
+  return sum;
+}
+
+%PrepareFunctionForOptimization(evaluate);
+%PrepareFunctionForOptimization(run);
+assertEquals(2, run());
+assertEquals(2, run());
+%OptimizeMaglevOnNextCall(evaluate);
+assertEquals(2, run());
+assertTrue(isMaglevved(evaluate));
+
+// A receiver with a new map deopts, but still computes the right result.
+class Twice {
+  constructor(e) { this.e = e; }
+  accept(visitor) { return 2 * evaluate(this.e); }
+}
+assertEquals(6, evaluate(new Twice(new Num(3))));
+
+// Two possible targets coming from a conditional.
+function f(x) { return x + 1; }
+function g(x) { return x * 2; }
+function pick(c, x) {
+  const fn = c ? f : g;
+  return fn(x);
+}
+
+%PrepareFunctionForOptimization(pick);
+assertEquals(4, pick(true, 3));
+assertEquals(6, pick(false, 3));
+%OptimizeMaglevOnNextCall(pick);
+assertEquals(4, pick(true, 3));
+assertEquals(6, pick(false, 3));
+assertTrue(isMaglevved(pick));
@@ -0,0 +1,65 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Flags: --allow-natives-syntax --min-cons-length-to-iterate=16
+
+// Relational comparisons of long cons strings visit their segments instead
+// of flattening them, which has to give the same results as comparing the
+// flat strings, including across segment boundaries of different sizes.
+
+function build(pieces) {
+  let result = '';
+  for (const piece of pieces) result += piece;
+  return result;
+}
+
+function compare(a, b) {
+  return [a < b, a <= b, a > b, a >= b];
+}
+
+// Compares fresh ropes built by {makeA} and {makeB}, and checks that the
+// long one is still a cons string afterwards, i.e. that the comparison
+// visited its segments instead of flattening it.
+function compareRopes(makeA, makeB) {
+  const a = makeA();
+  const b = makeB();
+  const unflattened = [a, b].filter(s => !%IsFlatString(s));
+  assertTrue(unflattened.length > 0);
+  const result = compare(a, b);
+  for (const s of unflattened) assertFalse(%IsFlatString(s));
+  return result;
+}
+
+const pieceSets = [
+  ['abcdefghijklmnop', 'qrstuvwxyz012345', '6789'],
+  ['abcdefgh', 'ijklmnopqrstuvwxyz0123', '456789'],
+  ['abcdefghijklmnopqrst', 'uvwxyz', '0123456789'],
+  ['abcdefghijklmnop', 'qrstuvwxyz012345', '6789☃'],
+  ['abcdefgh☃', 'ijklmnopqrstuvwxyz0123', '456789'],
+];
+
+for (const pieces of pieceSets) {
+  // Flat strings for the expected results, built separately from the ropes
+  // that are compared.
+  const flatString = pieces.join('');
+  assertTrue(%IsFlatString(flatString));
+  const makeString = () => build(pieces);
+  for (let i = 0; i <= flatString.length; i++) {
+    for (const c of ['0', 'a', 'z', '☃', '']) {
+      // A string that differs from {string} at position {i}, or is a
+      // prefix of it.
+      const makeOther = () => build([flatString.substring(0, i), c]);
+      const flatOther = %FlattenString(makeOther());
+      assertEquals(compare(flatString, flatOther),
+                   compareRopes(makeString, makeOther));
+      assertEquals(compare(flatOther, flatString),
+                   compareRopes(makeOther, makeString));
+      // And against a differently segmented version of itself.
+      const makeResegmented = () =>
+          build([flatString.substring(0, i), flatString.substring(i)]);
+      assertEquals([false, true, false, true],
+                   compareRopes(makeString, makeResegmented));
+    }
+  }
+}
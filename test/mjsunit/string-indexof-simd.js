@@ -0,0 +1,57 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+// Compares indexOf and includes against a naive search, for patterns that
+// start and end at every position around the vector block sizes, with
+// frequent false candidates for the first and the last character.
+
+function naiveIndexOf(subject, pattern, from) {
+  outer: for (let i = Math.max(from, 0);
+              i <= subject.length - pattern.length; i++) {
+    for (let j = 0; j < pattern.length; j++) {
+      if (subject[j + i] !== pattern[j]) continue outer;
+    }
+    return i;
+  }
+  return -1;
+}
+
+function check(subject, pattern, from) {
+  const expected = naiveIndexOf(subject, pattern, from);
+  assertEquals(expected, subject.indexOf(pattern, from), pattern);
+  assertEquals(expected != -1, subject.includes(pattern, from), pattern);
+}
+
+function test(filler, twoByte) {
+  const patterns = ['ab', 'aab', 'abab', 'aXb', 'abcdefghijk', 'aaaaaaab'];
+  if (twoByte) patterns.push('a☃b', '☃☃');
+  for (const pattern of patterns) {
+    for (let length = 0; length < 70; length++) {
+      // Neither the first nor the last character alone is a match.
+      let prefix = '';
+      while (prefix.length < length) prefix += filler;
+      prefix = prefix.substring(0, length);
+      const subject = prefix + pattern + prefix;
+      check(subject, pattern, 0);
+      check(subject, pattern, length);
+      check(subject, pattern, length + 1);
+      check(prefix, pattern, 0);
+    }
+  }
+}
+
+test('ab-b-aa', false);
+test('a☃b-ba', true);
+test('☃a', true);
+test('a\0', true);
+
+// Single characters in two-byte subjects.
+(() => {
+  const subject = '☃'.repeat(40) + 'x' + '☃'.repeat(40) + '\0';
+  assertEquals(40, subject.indexOf('x'));
+  assertEquals(-1, subject.indexOf('x', 41));
+  assertEquals(81, subject.indexOf('\0'));
+  assertEquals(0, subject.indexOf('☃'));
+  assertEquals(-1, subject.indexOf('☄'));
+})();
@@ -0,0 +1,67 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+//
+// Flags: --turboshaft --turboshaft-loop-unrolling --allow-natives-syntax
+
+// Element-wise typed array loops get a larger partial unrolling budget. Check
+// that the unrolled loops still produce the right results for trip counts that
+// are not multiples of the unrolling factor.
+
+function scale(dst, src, k) {
+  for (let i = 0; i < src.length; i++) {
+    dst[i] = src[i] * k + 1;
+  }
+}
+
+function sum(a) {
+  let s = 0;
+  for (let i = 0; i < a.length; i++) {
+    s += a[i];
+  }
+  return s;
+}
+
+function blend(dst, a, b) {
+  for (let i = 0; i < dst.length; i++) {
+    dst[i] = (a[i] + b[i]) >> 1;
+  }
+}
+
+function check(length) {
+  let src = new Float64Array(length);
+  let dst = new Float64Array(length);
+  let expected_sum = 0;
+  for (let i = 0; i < length; i++) {
+    src[i] = i * 0.5;
+    expected_sum += i * 0.5;
+  }
+  scale(dst, src, 3);
+  for (let i = 0; i < length; i++) assertEquals(i * 1.5 + 1, dst[i]);
+  assertEquals(expected_sum, sum(src));
+
+  let a = new Uint8Array(length);
+  let b = new Uint8Array(length);
+  let c = new Uint8Array(length);
+  for (let i = 0; i < length; i++) {
+    a[i] = i & 0xff;
+    b[i] = (i * 7) & 0xff;
+  }
+  blend(c, a, b);
+  for (let i = 0; i < length; i++) {
+    assertEquals(((i & 0xff) + ((i * 7) & 0xff)) >> 1, c[i]);
+  }
+}
+
+%PrepareFunctionForOptimization(scale);
+%PrepareFunctionForOptimization(sum);
+%PrepareFunctionForOptimization(blend);
+check(10);
+check(17);
+
+%OptimizeFunctionOnNextCall(scale);
+%OptimizeFunctionOnNextCall(sum);
+%OptimizeFunctionOnNextCall(blend);
+for (let length of [0, 1, 2, 3, 4, 5, 7, 8, 9, 31, 64, 1001]) {
+  check(length);
+}
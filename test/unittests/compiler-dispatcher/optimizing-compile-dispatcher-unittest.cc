@@ -13,6 +13,7 @@
 #include "src/execution/local-isolate.h"
 #include "src/handles/handles.h"
 #include "src/heap/local-heap.h"
+#include "src/objects/js-function-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/parsing/parse-info.h"
 #include "test/unittests/test-helpers.h"
@@ -28,11 +29,13 @@ namespace {
 
 class BlockingCompilationJob : public TurbofanCompilationJob {
  public:
-  BlockingCompilationJob(Isolate* isolate, Handle<JSFunction> function)
+  BlockingCompilationJob(Isolate* isolate, Handle<JSFunction> function,
+                         BytecodeOffset osr_offset = BytecodeOffset::None())
       : TurbofanCompilationJob(&info_, State::kReadyToExecute),
         shared_(function->shared(), isolate),
         zone_(isolate->allocator(), ZONE_NAME),
-        info_(&zone_, isolate, shared_, function, CodeKind::TURBOFAN),
+        info_(&zone_, isolate, shared_, function, CodeKind::TURBOFAN,
+              osr_offset),
         blocking_(false),
         semaphore_(0) {}
   ~BlockingCompilationJob() override = default;
@@ -96,5 +99,112 @@ TEST_F(OptimizingCompileDispatcherTest, NonBlockingFlush) {
   dispatcher.Stop();
 }
 
+TEST_F(OptimizingCompileDispatcherTest, LargeJobsDoNotBlockQueue) {
+  Handle<JSFunction> fun =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), fun, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  std::unique_ptr<BlockingCompilationJob> large1(
+      new BlockingCompilationJob(i_isolate(), fun));
+  std::unique_ptr<BlockingCompilationJob> large2(
+      new BlockingCompilationJob(i_isolate(), fun));
+  std::unique_ptr<BlockingCompilationJob> small(
+      new BlockingCompilationJob(i_isolate(), fun));
+
+  OptimizingCompileDispatcherQueue queue(8, 1);
+  queue.Enqueue(large1.get(), true);
+  queue.Enqueue(large2.get(), true);
+  queue.Enqueue(small.get(), false);
+  ASSERT_EQ(3, queue.RunnableLength());
+
+  bool is_large = false;
+  ASSERT_EQ(large1.get(), queue.Dequeue(&is_large));
+  ASSERT_TRUE(is_large);
+  // The second large job is held back while the first one is compiling.
+  ASSERT_EQ(1, queue.RunnableLength());
+  ASSERT_EQ(small.get(), queue.Dequeue(&is_large));
+  ASSERT_FALSE(is_large);
+  ASSERT_EQ(nullptr, queue.Dequeue(&is_large));
+  ASSERT_EQ(1, queue.Length());
+  ASSERT_EQ(0, queue.RunnableLength());
+
+  queue.LargeJobFinished();
+  ASSERT_EQ(1, queue.RunnableLength());
+  ASSERT_EQ(large2.get(), queue.Dequeue(&is_large));
+  ASSERT_TRUE(is_large);
+  queue.LargeJobFinished();
+  ASSERT_EQ(0, queue.Length());
+}
+
+TEST_F(OptimizingCompileDispatcherTest, OsrJobsAreQueuedFirst) {
+  Handle<JSFunction> fun =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), fun, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  std::unique_ptr<BlockingCompilationJob> regular1(
+      new BlockingCompilationJob(i_isolate(), fun));
+  std::unique_ptr<BlockingCompilationJob> regular2(
+      new BlockingCompilationJob(i_isolate(), fun));
+  std::unique_ptr<BlockingCompilationJob> osr1(
+      new BlockingCompilationJob(i_isolate(), fun, BytecodeOffset(0)));
+  std::unique_ptr<BlockingCompilationJob> osr2(
+      new BlockingCompilationJob(i_isolate(), fun, BytecodeOffset(0)));
+
+  OptimizingCompileDispatcherQueue queue(4);
+  queue.Enqueue(regular1.get());
+  queue.Enqueue(osr1.get());
+  queue.Enqueue(regular2.get());
+  queue.Enqueue(osr2.get());
+  ASSERT_FALSE(queue.IsAvailable());
+
+  // The youngest regular job is evicted first; OSR jobs are never evicted.
+  ASSERT_EQ(regular2.get(), queue.EvictNewestNonOsrJob());
+
+  bool is_large = false;
+  ASSERT_EQ(osr1.get(), queue.Dequeue(&is_large));
+  ASSERT_EQ(osr2.get(), queue.Dequeue(&is_large));
+  ASSERT_EQ(regular1.get(), queue.Dequeue(&is_large));
+  ASSERT_EQ(0, queue.Length());
+}
+
+TEST_F(OptimizingCompileDispatcherTest, StaleJobsAreRemoved) {
+  Handle<JSFunction> cold =
+      RunJS<JSFunction>("function f() { function g() {}; return g;}; f();");
+  Handle<JSFunction> hot =
+      RunJS<JSFunction>("function h() { function k() {}; return k;}; h();");
+  IsCompiledScope is_compiled_scope;
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), cold, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  ASSERT_TRUE(Compiler::Compile(i_isolate(), hot, Compiler::CLEAR_EXCEPTION,
+                                &is_compiled_scope));
+  JSFunction::EnsureFeedbackVector(i_isolate(), hot, &is_compiled_scope);
+  hot->set_tiering_state(i_isolate(), TieringState::kInProgress);
+  std::unique_ptr<BlockingCompilationJob> cold_job(
+      new BlockingCompilationJob(i_isolate(), cold));
+  std::unique_ptr<BlockingCompilationJob> hot_job(
+      new BlockingCompilationJob(i_isolate(), hot));
+
+  OptimizingCompileDispatcherQueue queue(4);
+  queue.Enqueue(cold_job.get());
+  queue.Enqueue(hot_job.get());
+
+  // The job for the function without feedback is stale.
+  std::vector<TurbofanCompilationJob*> stale_jobs;
+  queue.RemoveStaleJobs(&stale_jobs);
+  ASSERT_EQ(1u, stale_jobs.size());
+  ASSERT_EQ(cold_job.get(), stale_jobs[0]);
+  ASSERT_EQ(1, queue.Length());
+
+  // A deopt resets the tiering state, after which the other job is stale too.
+  hot->reset_tiering_state();
+  stale_jobs.clear();
+  queue.RemoveStaleJobs(&stale_jobs);
+  ASSERT_EQ(1u, stale_jobs.size());
+  ASSERT_EQ(hot_job.get(), stale_jobs[0]);
+  ASSERT_EQ(0, queue.Length());
+}
+
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,104 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/compiler/common-operator.h"
+#include "test/common/flag-utils.h"
+#include "test/common/node-observer-tester.h"
+#include "test/unittests/test-utils.h"
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+namespace compiler {
+
+using BranchHintsFromFeedbackTest = TestWithContextAndZone;
+
+namespace {
+
+// Checks the hint of the branch on the condition wrapped in %ObserveNode. The
+// branch is looked up when the condition is first changed after graph
+// building, at which point the branch exists.
+class BranchHintObserver : public NodeObserver {
+ public:
+  explicit BranchHintObserver(BranchHint expected) : expected_(expected) {}
+
+  Observation OnNodeChanged(const char* reducer_name, const Node* node,
+                            const ObservableNodeState& old_state) override {
+    Node* branch = FindBranch(const_cast<Node*>(node));
+    if (branch == nullptr) return Observation::kContinue;
+    EXPECT_EQ(expected_, BranchHintOf(branch->op()));
+    checked_ = true;
+    return Observation::kStop;
+  }
+
+  bool checked() const { return checked_; }
+
+ private:
+  // The branch uses the condition through a ToBoolean until that is optimized
+  // away.
+  static Node* FindBranch(Node* condition) {
+    for (Node* use : condition->uses()) {
+      if (use->opcode() == IrOpcode::kBranch) return use;
+      if (use->opcode() != IrOpcode::kToBoolean) continue;
+      for (Node* to_boolean_use : use->uses()) {
+        if (to_boolean_use->opcode() == IrOpcode::kBranch) {
+          return to_boolean_use;
+        }
+      }
+    }
+    return nullptr;
+  }
+
+  const BranchHint expected_;
+  bool checked_ = false;
+};
+
+}  // namespace
+
+TEST_F(BranchHintsFromFeedbackTest, BranchHintsFromFeedback) {
+  FlagScope<bool> allow_natives_syntax(&i::v8_flags.allow_natives_syntax, true);
+  FlagScope<bool> always_turbofan(&i::v8_flags.always_turbofan, false);
+  FlagScope<bool> hints_from_feedback(
+      &i::v8_flags.turbo_branch_hints_from_feedback, true);
+
+  struct {
+    const char* warmup;
+    BranchHint expected;
+  } cases[] = {
+      // Only the then arm ran, so the else arm is unlikely.
+      {"test({a: 1, b: 2}, 1);", BranchHint::kTrue},
+      // Only the else arm ran.
+      {"test({a: 1, b: 2}, -1);", BranchHint::kFalse},
+      // Both arms ran, there is nothing to hint.
+      {"test({a: 1, b: 2}, 1); test({a: 1, b: 2}, -1);", BranchHint::kNone},
+  };
+
+  for (const auto& c : cases) {
+    std::ostringstream src;
+    src << "function test(o, x) {\n"
+        << "  if (%ObserveNode(x > 0)) {\n"
+        << "    return o.a + 1;\n"
+        << "  } else {\n"
+        << "    return o.b - 1;\n"
+        << "  }\n"
+        << "}\n"
+        << "%PrepareFunctionForOptimization(test);\n"
+        << c.warmup << "\n"
+        << c.warmup << "\n"
+        << "%OptimizeFunctionOnNextCall(test);\n"
+        << c.warmup << "\n";
+
+    BranchHintObserver* observer =
+        zone()->New<BranchHintObserver>(c.expected);
+    {
+      compiler::ObserveNodeScope scope(i_isolate(), observer);
+      TryRunJS(src.str().c_str());
+    }
+    EXPECT_TRUE(observer->checked());
+  }
+}
+
+}  // namespace compiler
+}  // namespace internal
+}  // namespace v8
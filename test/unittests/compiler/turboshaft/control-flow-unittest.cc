@@ -7,7 +7,10 @@
 #include "src/compiler/turboshaft/branch-elimination-reducer.h"
 #include "src/compiler/turboshaft/copying-phase.h"
 #include "src/compiler/turboshaft/dead-code-elimination-reducer.h"
+#include "src/compiler/turboshaft/instruction-selection-phase.h"
+#include "src/compiler/turboshaft/loop-finder.h"
 #include "src/compiler/turboshaft/loop-peeling-reducer.h"
+#include "src/compiler/turboshaft/loop-unrolling-reducer.h"
 #include "src/compiler/turboshaft/machine-optimization-reducer.h"
 #include "src/compiler/turboshaft/operations.h"
 #include "src/compiler/turboshaft/representations.h"
@@ -135,6 +138,73 @@ TEST_F(ControlFlowTest, LoopPeelingSingleInputPhi) {
   test.Run<LoopPeelingReducer>();
 }
 
+// JS loops whose body loads raw (typed array) elements have a larger partial
+// unrolling budget than other JS loops. The element loop built here is just
+// too large for the default budget, and is only unrolled because it loads raw
+// elements: the same loop with tagged loads is not unrolled.
+TEST_F(ControlFlowTest, LoopUnrollingElementLoopBudget) {
+  auto create_loop = [&](int load_count, bool raw_elements, Block** header) {
+    return CreateFromGraph(1, [&](auto& Asm) {
+      V<Object> param = Asm.GetParameter(0);
+      OpIndex base = param;
+      LoadOp::Kind kind = LoadOp::Kind::TaggedBase();
+      if (raw_elements) {
+        base = __ BitcastTaggedToWordPtr(param);
+        kind = LoadOp::Kind::RawAligned();
+      }
+      V<WordPtr> index = __ IntPtrConstant(0);
+      Block* loop = __ NewLoopHeader();
+      Block *loop_body = __ NewBlock(), *outside = __ NewBlock();
+      __ Goto(loop);
+      __ Bind(loop);
+      __ Goto(loop_body);
+      __ Bind(loop_body);
+      V<Word32> sum = __ Word32Constant(0);
+      for (int i = 0; i < load_count; i++) {
+        V<Word32> element = V<Word32>::Cast(__ Load(
+            base, index, kind, MemoryRepresentation::Int32(), i * kInt32Size));
+        sum = __ Word32Add(sum, element);
+      }
+      __ GotoIf(sum, outside);
+      __ Goto(loop);
+      __ Bind(outside);
+      __ Return(__ Word32Constant(17));
+      *header = loop;
+    });
+  };
+  auto op_count = [&](TestInstance& test, const Block* header) {
+    LoopFinder loop_finder(zone(), &test.graph());
+    return loop_finder.GetLoopInfo(header).op_count;
+  };
+
+  // Find the smallest element loop that exceeds the default budget.
+  Block* header = nullptr;
+  int load_count = 1;
+  while (true) {
+    auto test = create_loop(load_count, true, &header);
+    if (op_count(test, header) >=
+        LoopUnrollingAnalyzer::kJSMaxLoopSizeForPartialUnrolling) {
+      break;
+    }
+    ++load_count;
+  }
+
+  {
+    auto test = create_loop(load_count, true, &header);
+    ASSERT_LT(op_count(test, header),
+              LoopUnrollingAnalyzer::kJSMaxElementLoopSizeForPartialUnrolling);
+    LoopUnrollingAnalyzer analyzer(zone(), &test.graph());
+    EXPECT_TRUE(analyzer.ShouldPartiallyUnrollLoop(header));
+  }
+  {
+    auto test = create_loop(load_count, false, &header);
+    ASSERT_GE(op_count(test, header),
+              LoopUnrollingAnalyzer::kJSMaxLoopSizeForPartialUnrolling);
+    LoopUnrollingAnalyzer analyzer(zone(), &test.graph());
+    EXPECT_FALSE(analyzer.ShouldPartiallyUnrollLoop(header));
+  }
+}
+
 // This test checks that DeadCodeElimination (DCE) eliminates dead blocks
 // regardless or whether they are reached through a Goto or a Branch.
 TEST_F(ControlFlowTest, DCEGoto) {
@@ -170,6 +240,60 @@ TEST_F(ControlFlowTest, DCEGoto) {
   ASSERT_LE(test.graph().block_count(), static_cast<size_t>(2));
 }
 
+// Blocks from which every path ends in a deopt or in unreachable code should be
+// deferred even without a branch hint, while the other side of the branch
+// stays hot.
+TEST_F(ControlFlowTest, PropagateDeferredToColdExits) {
+  Block* cold = nullptr;
+  Block* cold_tail = nullptr;
+  Block* hot = nullptr;
+  auto test = CreateFromGraph(1, [&](auto& Asm) {
+    V<Word32> cond =
+        __ TaggedEqual(Asm.GetParameter(0), __ SmiConstant(Smi::FromInt(0)));
+    cold = __ NewBlock();
+    cold_tail = __ NewBlock();
+    hot = __ NewBlock();
+    __ Branch(cond, cold, hot);
+
+    __ Bind(cold);
+    __ Goto(cold_tail);
+
+    __ Bind(cold_tail);
+    __ Unreachable();
+
+    __ Bind(hot);
+    __ Return(Asm.GetParameter(0));
+  });
+
+  PropagateDeferred(test.graph());
+
+  auto is_deferred = [](const Block* block) {
+    return block->get_custom_data(Block::CustomDataKind::kDeferredInSchedule);
+  };
+  EXPECT_FALSE(is_deferred(&test.graph().StartBlock()));
+  EXPECT_TRUE(is_deferred(cold));
+  EXPECT_TRUE(is_deferred(cold_tail));
+  EXPECT_FALSE(is_deferred(hot));
+}
+
+// Only the targets of a branch are deferred for reaching a cold exit. A block
+// that is entered unconditionally stays hot.
+TEST_F(ControlFlowTest, PropagateDeferredOnlyToBranchTargets) {
+  Block* cold_exit = nullptr;
+  auto test = CreateFromGraph(1, [&](auto& Asm) {
+    cold_exit = __ NewBlock();
+    __ Goto(cold_exit);
+
+    __ Bind(cold_exit);
+    __ Unreachable();
+  });
+
+  PropagateDeferred(test.graph());
+
+  EXPECT_FALSE(cold_exit->get_custom_data(
+      Block::CustomDataKind::kDeferredInSchedule));
+}
+
 #include "src/compiler/turboshaft/undef-assembler-macros.inc"
 
 }  // namespace v8::internal::compiler::turboshaft
@@ -11,8 +11,10 @@
 
 #include "include/v8-function.h"
 #include "src/heap/factory.h"
+#include "src/heap/heap.h"
 #include "src/objects/foreign.h"
 #include "src/objects/js-array-inl.h"
+#include "src/objects/js-generator-inl.h"
 #include "src/objects/js-objects-inl.h"
 #include "src/objects/objects-inl.h"
 #include "src/objects/promise-inl.h"
@@ -192,6 +194,94 @@ TEST_P(MicrotaskQueueTest, BufferGrowth) {
   EXPECT_EQ(MicrotaskQueue::kMinimumCapacity + 2, count);
 }
 
+// Check that the statistics account for every microtask and checkpoint.
+TEST_P(MicrotaskQueueTest, Statistics) {
+  v8::MicrotaskQueueStatistics statistics = microtask_queue()->GetStatistics();
+  EXPECT_EQ(0u, statistics.microtask_count);
+  EXPECT_EQ(0u, statistics.checkpoint_count);
+  EXPECT_EQ(0u, statistics.max_queue_depth);
+
+  // An empty checkpoint doesn't count.
+  EXPECT_EQ(0, microtask_queue()->RunMicrotasks(isolate()));
+  EXPECT_EQ(0u, microtask_queue()->GetStatistics().checkpoint_count);
+
+  for (int i = 0; i < 3; ++i) {
+    microtask_queue()->EnqueueMicrotask(*NewMicrotask([] {}));
+  }
+  EXPECT_EQ(3, microtask_queue()->RunMicrotasks(isolate()));
+
+  // Microtasks enqueued by a running microtask are part of the same
+  // checkpoint, but don't count towards its depth.
+  microtask_queue()->EnqueueMicrotask(*NewMicrotask([this] {
+    microtask_queue()->EnqueueMicrotask(*NewMicrotask([] {}));
+  }));
+  EXPECT_EQ(2, microtask_queue()->RunMicrotasks(isolate()));
+
+  statistics = microtask_queue()->GetStatistics();
+  EXPECT_EQ(5u, statistics.microtask_count);
+  EXPECT_EQ(2u, statistics.checkpoint_count);
+  EXPECT_EQ(3u, statistics.max_queue_depth);
+  EXPECT_LE(0, statistics.run_time_ms);
+}
+
+// An async function creates its resolve closure on the first await and reuses
+// it afterwards. Awaiting fulfilled promises doesn't create the reject closure
+// at all, unless a PromiseHook may see it.
+TEST_P(MicrotaskQueueTest, AsyncFunctionAwaitClosures) {
+  microtask_queue()->set_microtasks_policy(MicrotasksPolicy::kExplicit);
+  RunJS(
+      "var resume;"
+      "async function f() {"
+      "  await 1;"
+      "  await Promise.resolve(2);"
+      "  await new Promise(r => resume = r);"
+      "}"
+      "f();");
+
+  Handle<JSAsyncFunctionObject> async_function_object;
+  {
+    HeapObjectIterator iterator(isolate()->heap());
+    for (Tagged<HeapObject> obj = iterator.Next(); !obj.is_null();
+         obj = iterator.Next()) {
+      if (!IsJSAsyncFunctionObject(obj)) continue;
+      ASSERT_TRUE(async_function_object.is_null());
+      async_function_object =
+          handle(JSAsyncFunctionObject::cast(obj), isolate());
+    }
+  }
+  ASSERT_FALSE(async_function_object.is_null());
+
+  // Suspended at `await 1`.
+  ASSERT_TRUE(IsJSFunction(async_function_object->await_resolve_closure()));
+  Handle<JSFunction> on_resolve(
+      JSFunction::cast(async_function_object->await_resolve_closure()),
+      isolate());
+  EXPECT_EQ(GetParam(),
+            IsJSFunction(async_function_object->await_reject_closure()));
+
+  // This microtask runs while suspended at `await Promise.resolve(2)`, which
+  // reuses the resolve closure.
+  bool checked = false;
+  microtask_queue()->EnqueueMicrotask(*NewMicrotask([&] {
+    EXPECT_EQ(*on_resolve, async_function_object->await_resolve_closure());
+    EXPECT_EQ(GetParam(),
+              IsJSFunction(async_function_object->await_reject_closure()));
+    checked = true;
+  }));
+
+  // Suspended at the pending promise, which needs the reject closure.
+  EXPECT_EQ(3, microtask_queue()->RunMicrotasks(isolate()));
+  EXPECT_TRUE(checked);
+  EXPECT_EQ(*on_resolve, async_function_object->await_resolve_closure());
+  ASSERT_TRUE(IsJSFunction(async_function_object->await_reject_closure()));
+  EXPECT_EQ(on_resolve->context(),
+            JSFunction::cast(async_function_object->await_reject_closure())
+                ->context());
+
+  RunJS("resume()");
+  EXPECT_EQ(1, microtask_queue()->RunMicrotasks(isolate()));
+}
+
 // MicrotaskQueue instances form a doubly linked list.
 TEST_P(MicrotaskQueueTest, InstanceChain) {
   ClearTestMicrotaskQueue();
@@ -16,6 +16,7 @@
 #include "src/interpreter/constant-array-builder.h"
 #include "src/utils/utils.h"
 #include "src/objects/objects-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/interpreter/bytecode-utils.h"
 #include "test/unittests/test-utils.h"
 
@@ -370,6 +371,89 @@ TEST_F(BytecodeArrayWriterUnittest, DeadcodeElimination) {
   CHECK(source_iterator.done());
 }
 
+TEST_F(BytecodeArrayWriterUnittest, JumpThreading) {
+  FlagScope<bool> jump_threading(&v8_flags.ignition_jump_threading, true);
+
+  static const uint8_t expected_bytes[] = {
+      // clang-format off
+      /*  0        */ B(LdaTrue),
+      /*  1        */ B(JumpIfTrue), U8(9),
+      /*  3        */ B(Jump), U8(9),
+      /*  5        */ B(JumpIfTrue), U8(5),
+      /*  7        */ B(LdaZero),
+      /*  8        */ B(Jump), U8(4),
+      /* 10  65 S> */ B(Jump), U8(2),
+      /* 12        */ B(Return),
+      // clang-format on
+  };
+
+  BytecodeLabel to_conditional, to_jump, to_statement, to_return,
+      statement_to_return;
+
+  Write(Bytecode::kLdaTrue);
+  // Threaded through the conditional jump on the same condition, up to the
+  // jump with a statement position.
+  WriteJump(Bytecode::kJumpIfTrue, &to_conditional);
+  // Threaded through the unconditional jump.
+  WriteJump(Bytecode::kJump, &to_jump);
+  writer()->BindLabel(&to_conditional);
+  WriteJump(Bytecode::kJumpIfTrue, &to_statement);
+  Write(Bytecode::kLdaZero);
+  writer()->BindLabel(&to_jump);
+  WriteJump(Bytecode::kJump, &to_return);
+  writer()->BindLabel(&to_statement);
+  WriteJump(Bytecode::kJump, &statement_to_return, {65, true});
+  writer()->BindLabel(&to_return);
+  writer()->BindLabel(&statement_to_return);
+  Write(Bytecode::kReturn);
+
+  Handle<BytecodeArray> bytecode_array = writer()->ToBytecodeArray(
+      isolate(), 0, 0, factory()->empty_trusted_byte_array());
+  CHECK_EQ(bytecode_array->length(),
+           static_cast<int>(arraysize(expected_bytes)));
+  for (size_t i = 0; i < arraysize(expected_bytes); ++i) {
+    CHECK_EQ(bytecode_array->get(static_cast<int>(i)), expected_bytes[i]);
+  }
+}
+
+TEST_F(BytecodeArrayWriterUnittest, JumpThreadingStopsAtLoopHeaders) {
+  FlagScope<bool> jump_threading(&v8_flags.ignition_jump_threading, true);
+
+  static const uint8_t expected_bytes[] = {
+      // clang-format off
+      /*  0 */ B(LdaTrue),
+      /*  1 */ B(Jump), U8(2),
+      /*  3 */ B(Jump), U8(2),
+      /*  5 */ B(JumpIfFalse), U8(6),
+      /*  7 */ B(JumpLoop), U8(4), U8(0), U8(0),
+      /* 11 */ B(Return),
+      // clang-format on
+  };
+
+  BytecodeLabel to_loop, to_condition, exit;
+  BytecodeLoopHeader loop_header;
+
+  Write(Bytecode::kLdaTrue);
+  WriteJump(Bytecode::kJump, &to_loop);
+  writer()->BindLabel(&to_loop);
+  writer()->BindLoopHeader(&loop_header);
+  // Threading the jump into the loop through this one would skip the header.
+  WriteJump(Bytecode::kJump, &to_condition);
+  writer()->BindLabel(&to_condition);
+  WriteJump(Bytecode::kJumpIfFalse, &exit);
+  WriteJumpLoop(Bytecode::kJumpLoop, &loop_header, 0, 0);
+  writer()->BindLabel(&exit);
+  Write(Bytecode::kReturn);
+
+  Handle<BytecodeArray> bytecode_array = writer()->ToBytecodeArray(
+      isolate(), 0, 0, factory()->empty_trusted_byte_array());
+  CHECK_EQ(bytecode_array->length(),
+           static_cast<int>(arraysize(expected_bytes)));
+  for (size_t i = 0; i < arraysize(expected_bytes); ++i) {
+    CHECK_EQ(bytecode_array->get(static_cast<int>(i)), expected_bytes[i]);
+  }
+}
+
 #undef B
 #undef R
 
@@ -11,6 +11,7 @@
 #include "src/interpreter/constant-array-builder.h"
 #include "src/numbers/hash-seed-inl.h"
 #include "src/objects/objects-inl.h"
+#include "test/common/flag-utils.h"
 #include "test/unittests/test-utils.h"
 
 namespace v8 {
@@ -389,6 +390,41 @@ TEST_F(ConstantArrayBuilderTest, AllocateEntriesWithFixedReservations) {
   }
 }
 
+TEST_F(ConstantArrayBuilderTest, ShareIdenticalConstantPools) {
+  FlagScope<bool> share_constant_pools(
+      &v8_flags.ignition_share_constant_pools, true);
+  AstValueFactory ast_factory(zone(), isolate()->ast_string_constants(),
+                              HashSeed(isolate()));
+  const AstRawString* name = ast_factory.GetOneByteString("name");
+  ast_factory.Internalize(isolate());
+
+  auto make_constant_pool = [&](double number) {
+    ConstantArrayBuilder builder(zone());
+    builder.Insert(name);
+    builder.Insert(Smi::FromInt(42));
+    builder.Insert(number);
+    return builder.ToFixedArray(isolate());
+  };
+
+  auto make_shareable_constant_pool = [&]() {
+    ConstantArrayBuilder builder(zone());
+    builder.Insert(name);
+    builder.Insert(Smi::FromInt(42));
+    return builder.ToFixedArray(isolate());
+  };
+
+  // Pools with only internalized strings and Smis are shared.
+  Handle<TrustedFixedArray> first = make_shareable_constant_pool();
+  Handle<TrustedFixedArray> second = make_shareable_constant_pool();
+  CHECK_EQ(2, first->length());
+  CHECK(first.is_identical_to(second));
+
+  // Pools with other heap objects are not.
+  Handle<TrustedFixedArray> with_number = make_constant_pool(0.5);
+  CHECK_EQ(3, with_number->length());
+  CHECK(!with_number.is_identical_to(make_constant_pool(0.5)));
+}
+
 }  // namespace interpreter
 }  // namespace internal
 }  // namespace v8
@@ -0,0 +1,115 @@
+// Copyright 2024 the V8 project authors. All rights reserved.
+// Use of this source code is governed by a BSD-style license that can be
+// found in the LICENSE file.
+
+#include "src/json/json-simd.h"
+
+#include <vector>
+
+#include "testing/gtest/include/gtest/gtest.h"
+
+namespace v8 {
+namespace internal {
+
+namespace {
+
+// Longer than the widest vector plus a scalar tail.
+constexpr int kLength = 80;
+
+template <typename Char>
+std::vector<Char> Filled(Char c) {
+  return std::vector<Char>(kLength, c);
+}
+
+}  // namespace
+
+TEST(JsonSimdTest, FindStringTerminatorOneByte) {
+  const uint8_t terminators[] = {'"', '\\', 0x00, 0x0A, 0x1F};
+  for (uint8_t terminator : terminators) {
+    for (int start = 0; start < kLength; start++) {
+      for (int pos = start; pos <= kLength; pos++) {
+        // Characters around the terminator range must not match.
+        std::vector<uint8_t> chars = Filled<uint8_t>(pos % 2 ? 0x20 : 0xFF);
+        if (pos < kLength) chars[pos] = terminator;
+        const uint8_t* begin = chars.data();
+        EXPECT_EQ(begin + pos, FindJsonStringTerminator(begin + start,
+                                                        begin + kLength));
+      }
+    }
+  }
+}
+
+TEST(JsonSimdTest, FindStringTerminatorTwoByte) {
+  const uint16_t terminators[] = {'"', '\\', 0x00, 0x1F};
+  for (uint16_t terminator : terminators) {
+    for (int start = 0; start < kLength; start++) {
+      for (int pos = start; pos <= kLength; pos++) {
+        // Two-byte characters whose low byte is a terminator don't match.
+        std::vector<uint16_t> chars = Filled<uint16_t>(0x100 | terminator);
+        if (pos < kLength) chars[pos] = terminator;
+        const uint16_t* begin = chars.data();
+        base::uc32 bits = 0;
+        EXPECT_EQ(begin + pos, FindJsonStringTerminator(
+                                   begin + start, begin + kLength, &bits));
+        EXPECT_EQ(pos > start, bits > 0xFF);
+      }
+    }
+  }
+
+  // One-byte characters in front of the terminator don't set any bits.
+  std::vector<uint16_t> chars = Filled<uint16_t>('a');
+  chars[kLength - 1] = '"';
+  base::uc32 bits = 0;
+  EXPECT_EQ(chars.data() + kLength - 1,
+            FindJsonStringTerminator(chars.data(), chars.data() + kLength,
+                                     &bits));
+  EXPECT_LE(bits, 0xFFu);
+
+  // Two-byte characters behind the terminator don't set any bits.
+  chars[kLength - 1] = 0x1234;
+  chars[kLength / 2] = '\\';
+  bits = 0;
+  EXPECT_EQ(chars.data() + kLength / 2,
+            FindJsonStringTerminator(chars.data(), chars.data() + kLength,
+                                     &bits));
+  EXPECT_LE(bits, 0xFFu);
+}
+
+TEST(JsonSimdTest, FindEscapeCharacterTwoByte) {
+  const uint16_t escapes[] = {'"', '\\', 0x00, 0x1F, 0xD800, 0xDBFF, 0xDFFF};
+  for (uint16_t escape : escapes) {
+    for (int start = 0; start < kLength; start++) {
+      for (int pos = start; pos <= kLength; pos++) {
+        // Characters around the surrogate range must not match.
+        std::vector<uint16_t> chars =
+            Filled<uint16_t>(pos % 2 ? 0xD7FF : 0xE000);
+        if (pos < kLength) chars[pos] = escape;
+        const uint16_t* begin = chars.data();
+        EXPECT_EQ(begin + pos,
+                  FindJsonEscapeCharacter(begin + start, begin + kLength));
+      }
+    }
+  }
+}
+
+TEST(JsonSimdTest, SkipWhitespace) {
+  const char whitespace[] = {' ', '\t', '\n', '\r'};
+  for (int start = 0; start < kLength; start++) {
+    for (int pos = start; pos <= kLength; pos++) {
+      std::vector<uint8_t> one_byte = Filled<uint8_t>('{');
+      std::vector<uint16_t> two_byte = Filled<uint16_t>(0x100 | ' ');
+      for (int i = start; i < pos; i++) {
+        one_byte[i] = two_byte[i] = whitespace[i % 4];
+      }
+      EXPECT_EQ(one_byte.data() + pos,
+                SkipJsonWhitespace(one_byte.data() + start,
+                                   one_byte.data() + kLength));
+      EXPECT_EQ(two_byte.data() + pos,
+                SkipJsonWhitespace(two_byte.data() + start,
+                                   two_byte.data() + kLength));
+    }
+  }
+}
+
+}  // namespace internal
+}  // namespace v8
@@ -11,6 +11,8 @@
 #include "src/objects/objects-inl.h"
 #include "src/objects/objects.h"
 #include "src/objects/ordered-hash-table.h"
+#include "src/objects/string-table.h"
+#include "src/strings/string-hasher-inl.h"
 #include "src/third_party/siphash/halfsiphash.h"
 #include "src/utils/utils.h"
 #include "test/unittests/test-utils.h"
@@ -303,5 +305,64 @@ TEST_F(HashcodeTest, DefaultHashQuality) {
   TestIntegerHashQuality(DefaultHash);
 }
 
+TEST_F(HashcodeTest, StringHashIndependentOfEncoding) {
+  // Strings with the same contents have the same hash whether they are stored
+  // as one-byte or as two-byte characters, for all lengths around the block
+  // size of the block string hash, and for both index and non-index strings.
+  uint64_t seed = HashSeed(i_isolate());
+  const char* inputs[] = {"abcdefghijklmnopqrstuvwxyz0123456789ABCD",
+                          "9007199254740991", "4294967295", "12345678x"};
+  for (const char* input : inputs) {
+    int input_length = static_cast<int>(strlen(input));
+    std::vector<uint8_t> one_byte(input, input + input_length);
+    std::vector<uint16_t> two_byte(input, input + input_length);
+    for (int length = 0; length <= input_length; length++) {
+      CHECK_EQ(
+          StringHasher::HashSequentialString(one_byte.data(), length, seed),
+          StringHasher::HashSequentialString(two_byte.data(), length, seed));
+    }
+  }
+}
+
+TEST_F(HashcodeTest, StringTableLookupKeys) {
+  Factory* factory = i_isolate()->factory();
+  uint64_t seed = HashSeed(i_isolate());
+  Handle<String> existing = factory->InternalizeUtf8String("existing");
+  const char* inputs[] = {"existing", "batched", "other", "batched"};
+  std::vector<OneByteStringKey> keys;
+  for (const char* input : inputs) {
+    keys.emplace_back(base::OneByteVector(input, strlen(input)), seed);
+  }
+  std::vector<Handle<String>> results(keys.size());
+  i_isolate()->string_table()->LookupKeys(i_isolate(), base::VectorOf(keys),
+                                          base::VectorOf(results));
+  for (size_t i = 0; i < keys.size(); i++) {
+    CHECK(IsInternalizedString(*results[i]));
+    CHECK(results[i]->IsOneByteEqualTo(base::CStrVector(inputs[i])));
+  }
+  CHECK_EQ(*existing, *results[0]);
+  CHECK_EQ(*results[1], *results[3]);
+  CHECK_EQ(*factory->InternalizeUtf8String("other"), *results[2]);
+
+  // A second batch only finds existing strings.
+  int elements = i_isolate()->string_table()->NumberOfElements();
+  std::vector<TwoByteStringKey> two_byte_keys;
+  std::vector<std::vector<uint16_t>> two_byte_inputs;
+  for (const char* input : inputs) {
+    two_byte_inputs.emplace_back(input, input + strlen(input));
+  }
+  for (const std::vector<uint16_t>& input : two_byte_inputs) {
+    two_byte_keys.emplace_back(base::VectorOf(input), seed);
+  }
+  std::vector<Handle<String>> two_byte_results(two_byte_keys.size());
+  i_isolate()->string_table()->LookupKeys(i_isolate(),
+                                          base::VectorOf(two_byte_keys),
+                                          base::VectorOf(two_byte_results));
+  CHECK_EQ(elements, i_isolate()->string_table()->NumberOfElements());
+  for (size_t i = 0; i < keys.size(); i++) {
+    CHECK_EQ(*results[i], *two_byte_results[i]);
+  }
+}
+
 }  // namespace internal
 }  // namespace v8
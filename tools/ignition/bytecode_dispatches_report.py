@@ -0,0 +1,167 @@
+#!/usr/bin/env python3
+# Copyright 2024 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+import argparse
+import heapq
+import json
+import os
+import re
+import sys
+
+__DESCRIPTION = """
+Process one or more Ignition bytecode dispatch counter files and report the
+most frequent bytecode dispatches.
+
+The counters files are written by d8 when V8 is built with
+v8_enable_ignition_dispatch_counting=true and run with
+--trace-ignition-dispatches-output-file=<file>. Counters from several files,
+e.g. from different representative workloads, are summed before reporting.
+"""
+
+__HELP_EPILOGUE = """
+examples:
+  # Print the 20 most frequent dispatch pairs over three workloads.
+  $ bytecode_dispatches_report.py -n 20 a.json b.json c.json
+
+  # Print the bytecodes that are frequently followed by a short Star, and
+  # which don't inline it yet.
+  $ bytecode_dispatches_report.py --star-lookahead-candidates a.json b.json
+"""
+
+V8_ROOT = os.path.dirname(
+    os.path.dirname(os.path.dirname(os.path.abspath(__file__))))
+BYTECODES_CC = os.path.join(V8_ROOT, 'src', 'interpreter', 'bytecodes.cc')
+
+SHORT_STAR_RE = re.compile(r'^Star\d+$')
+
+
+def merge_counters(counters_list):
+  merged = {}
+  for counters in counters_list:
+    for source, row in counters.items():
+      merged_row = merged.setdefault(source, {})
+      for destination, count in row.items():
+        merged_row[destination] = merged_row.get(destination, 0) + count
+  return merged
+
+
+def load_counters(paths):
+  counters_list = []
+  for path in paths:
+    with open(path) as f:
+      counters_list.append(json.load(f))
+  return merge_counters(counters_list)
+
+
+def top_dispatch_pairs(counters, n):
+  pairs = ((count, source, destination)
+           for source, row in counters.items()
+           for destination, count in row.items())
+  return [(source, destination, count)
+          for count, source, destination in heapq.nlargest(n, pairs)]
+
+
+def star_lookahead_candidates(counters, min_count, min_ratio):
+  """Returns (bytecode, star_dispatches, total_dispatches) tuples for the
+  bytecodes that dispatch to a short Star often enough to be worth inlining,
+  sorted by the number of dispatches to short Stars."""
+  candidates = []
+  for source, row in counters.items():
+    if SHORT_STAR_RE.match(source):
+      continue
+    total = sum(row.values())
+    star = sum(
+        count for destination, count in row.items()
+        if SHORT_STAR_RE.match(destination))
+    if total == 0 or star < min_count or star < min_ratio * total:
+      continue
+    candidates.append((source, star, total))
+  candidates.sort(key=lambda candidate: candidate[1], reverse=True)
+  return candidates
+
+
+def read_star_lookahead_bytecodes(bytecodes_cc=BYTECODES_CC):
+  """Returns the bytecodes that already inline a following short Star, as
+  listed in Bytecodes::IsStarLookahead."""
+  with open(bytecodes_cc) as f:
+    source = f.read()
+  match = re.search(r'bool Bytecodes::IsStarLookahead\(.*?\n}\n', source,
+                    re.DOTALL)
+  if not match:
+    return set()
+  return set(re.findall(r'case Bytecode::k(\w+):', match.group(0)))
+
+
+def print_top_pairs(counters, n):
+  total = sum(sum(row.values()) for row in counters.values())
+  for source, destination, count in top_dispatch_pairs(counters, n):
+    print('{:>12d}\t{:5.1f}%\t{} -> {}'.format(count, 100.0 * count / total,
+                                               source, destination))
+
+
+def print_star_lookahead_candidates(counters, min_count, min_ratio):
+  # Dispatches from bytecodes that already inline a following short Star
+  # skip the Star, so these bytecodes can't show up as candidates anyway.
+  existing = read_star_lookahead_bytecodes()
+  for source, star, total in star_lookahead_candidates(counters, min_count,
+                                                       min_ratio):
+    if source in existing:
+      continue
+    print('{:>12d}\t{:5.1f}%\t{}'.format(star, 100.0 * star / total, source))
+
+
+def parse_command_line():
+  command_line_parser = argparse.ArgumentParser(
+      formatter_class=argparse.RawDescriptionHelpFormatter,
+      description=__DESCRIPTION,
+      epilog=__HELP_EPILOGUE)
+
+  command_line_parser.add_argument(
+      '--top-dispatches-pairs',
+      '-n',
+      metavar='N',
+      type=int,
+      default=20,
+      help='print the N most frequent dispatch pairs (default: %(default)s)')
+  command_line_parser.add_argument(
+      '--star-lookahead-candidates',
+      '-s',
+      action='store_true',
+      help=('print the bytecodes that are frequently followed by a short Star '
+            'and are not in Bytecodes::IsStarLookahead yet'))
+  command_line_parser.add_argument(
+      '--min-star-count',
+      type=int,
+      default=1000,
+      help=('minimum number of dispatches to a short Star for a candidate '
+            '(default: %(default)s)'))
+  command_line_parser.add_argument(
+      '--min-star-ratio',
+      type=float,
+      default=0.5,
+      help=('minimum share of the dispatches of a candidate that go to a '
+            'short Star (default: %(default)s)'))
+  command_line_parser.add_argument(
+      'input_filenames',
+      metavar='<counters file>',
+      nargs='+',
+      help='dispatch counters files, as written by d8')
+
+  return command_line_parser.parse_args()
+
+
+def main():
+  program_options = parse_command_line()
+  counters = load_counters(program_options.input_filenames)
+
+  if program_options.star_lookahead_candidates:
+    print_star_lookahead_candidates(counters, program_options.min_star_count,
+                                    program_options.min_star_ratio)
+  else:
+    print_top_pairs(counters, program_options.top_dispatches_pairs)
+
+
+if __name__ == '__main__':
+  main()
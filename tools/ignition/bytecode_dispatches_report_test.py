@@ -0,0 +1,64 @@
+#!/usr/bin/env python3
+# Copyright 2024 the V8 project authors. All rights reserved.
+# Use of this source code is governed by a BSD-style license that can be
+# found in the LICENSE file.
+
+import os
+import sys
+import unittest
+
+sys.path.insert(0, os.path.dirname(os.path.abspath(__file__)))
+
+import bytecode_dispatches_report as bdr
+
+
+class BytecodeDispatchesReportTest(unittest.TestCase):
+
+  def test_merge_counters(self):
+    merged = bdr.merge_counters([
+        {'Ldar': {'Add': 10, 'Star0': 2}, 'Add': {}},
+        {'Ldar': {'Add': 5}, 'LdaTrue': {'Star1': 7}},
+    ])
+    self.assertEqual(merged, {
+        'Ldar': {'Add': 15, 'Star0': 2},
+        'Add': {},
+        'LdaTrue': {'Star1': 7},
+    })
+
+  def test_top_dispatch_pairs(self):
+    counters = {
+        'Ldar': {'Add': 15, 'Star0': 2},
+        'LdaTrue': {'Star1': 7},
+    }
+    self.assertEqual(
+        bdr.top_dispatch_pairs(counters, 2),
+        [('Ldar', 'Add', 15), ('LdaTrue', 'Star1', 7)])
+
+  def test_star_lookahead_candidates(self):
+    counters = {
+        # Mostly followed by short Stars.
+        'LdaTrue': {'Star0': 60, 'Star3': 30, 'Return': 10},
+        # Followed by short Stars, but not often enough.
+        'Ldar': {'Star0': 10, 'Add': 90},
+        # Followed by the wide Star only.
+        'Mov': {'Star': 100},
+        # Short Stars themselves are never candidates.
+        'Star0': {'Star1': 100},
+        'Div': {'Star2': 40, 'Return': 20},
+    }
+    self.assertEqual(
+        bdr.star_lookahead_candidates(counters, min_count=1, min_ratio=0.5),
+        [('LdaTrue', 90, 100), ('Div', 40, 60)])
+    self.assertEqual(
+        bdr.star_lookahead_candidates(counters, min_count=50, min_ratio=0.5),
+        [('LdaTrue', 90, 100)])
+
+  def test_read_star_lookahead_bytecodes(self):
+    existing = bdr.read_star_lookahead_bytecodes()
+    self.assertIn('LdaZero', existing)
+    self.assertIn('DebugBreak0', existing)
+    self.assertNotIn('Star0', existing)
+
+
+if __name__ == '__main__':
+  unittest.main()